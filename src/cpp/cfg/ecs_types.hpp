@@ -58,6 +58,12 @@
 // Include C++ mutex
 #include <mutex>
 
+// Include C++ thread
+#include <thread>
+
+// Include C++ condition_variable
+#include <condition_variable>
+
 #endif // !MECS_LIB_MT_ENABLED
 // MULTI-THREADING
 
@@ -70,6 +76,9 @@
 // Include C++ map
 #include <map>
 
+// Include C++ unordered_map
+#include <unordered_map>
+
 // Include C++ definitions
 #include <cstddef>
 
@@ -79,6 +88,15 @@
 // Include C++ limits
 #include <limits>
 
+// Include C++ chrono
+#include <chrono>
+
+// Include C++ functional
+#include <functional>
+
+// Include C++ bitset
+#include <bitset>
+
 // ===========================================================
 // NUMERIC
 // ===========================================================
@@ -96,7 +114,10 @@ namespace mecs
 	using ObjectID = std::uint16_t;
 	
 	/** Invalid Object-ID. **/
-	static constexpr const TypeID INVALID_OBJECT_ID = std::numeric_limits<ObjectID>::max( ) - 1;
+	static constexpr const ObjectID INVALID_OBJECT_ID = std::numeric_limits<ObjectID>::max( ) - 1;
+	
+	/** Type-alias for set of Type-IDs. **/
+	using mecs_types_set = std::bitset<static_cast<std::size_t>( std::numeric_limits<TypeID>::max( ) ) + 1>;
 	
 	/** Type-alias for shared-pointer. **/
 	template <typename T>
@@ -117,6 +138,12 @@ namespace mecs
 	/** Type-alias for atomic-boolean value-type. **/
 	using mecs_abool = std::atomic_bool;
 	
+	/** Type-alias for thread-id. **/
+	using mecs_thread_id = std::thread::id;
+
+	/** Type-alias for condition-variable. **/
+	using mecs_condition = std::condition_variable;
+	
 #endif // MULTI-THREADING
 	
 	/** Alias for vector container. **/
@@ -127,6 +154,10 @@ namespace mecs
 	template <typename K, typename V>
 	using mecs_map = std::map<K, V>;
 	
+	/** Type-alias for hash-map. **/
+	template <typename K, typename V>
+	using mecs_hash_map = std::unordered_map<K, V>;
+	
 	/** Alias for deque. **/
 	template <typename T>
 	using mecs_deque = std::deque<T>;
@@ -179,6 +210,13 @@ namespace mecs { class SystemsManager; }
 using mecs_SystemsManager = mecs::SystemsManager;
 #endif // !MECS_SYSTEMS_MANAGER_DECL
 
+// mecs::CoroutinesSystem
+#ifndef MECS_COROUTINES_SYSTEM_DECL
+#define MECS_COROUTINES_SYSTEM_DECL
+namespace mecs { class CoroutinesSystem; }
+using mecs_CoroutinesSystem = mecs::CoroutinesSystem;
+#endif // !MECS_COROUTINES_SYSTEM_DECL
+
 // mecs::Event
 #ifndef MECS_EVENT_DECL
 #define MECS_EVENT_DECL
@@ -200,6 +238,41 @@ namespace mecs { class IEventListener; }
 using mecs_IEventListener = mecs::IEventListener;
 #endif // !MECS_I_EVENT_LISTENER_DECL
 
+// mecs::CommandBuffer
+#ifndef MECS_COMMAND_BUFFER_DECL
+#define MECS_COMMAND_BUFFER_DECL
+namespace mecs { class CommandBuffer; }
+using mecs_CommandBuffer = mecs::CommandBuffer;
+#endif // !MECS_COMMAND_BUFFER_DECL
+
+// mecs::CommandsManager
+#ifndef MECS_COMMANDS_MANAGER_DECL
+#define MECS_COMMANDS_MANAGER_DECL
+namespace mecs { class CommandsManager; }
+using mecs_CommandsManager = mecs::CommandsManager;
+#endif // !MECS_COMMANDS_MANAGER_DECL
+
+// mecs::EpochReclaimer
+#ifndef MECS_EPOCH_RECLAIMER_DECL
+#define MECS_EPOCH_RECLAIMER_DECL
+namespace mecs { class EpochReclaimer; }
+using mecs_EpochReclaimer = mecs::EpochReclaimer;
+#endif // !MECS_EPOCH_RECLAIMER_DECL
+
+// mecs::World
+#ifndef MECS_WORLD_DECL
+#define MECS_WORLD_DECL
+namespace mecs { class World; }
+using mecs_World = mecs::World;
+#endif // !MECS_WORLD_DECL
+
+// mecs::ThreadPool
+#ifndef MECS_THREAD_POOL_DECL
+#define MECS_THREAD_POOL_DECL
+namespace mecs { class ThreadPool; }
+using mecs_ThreadPool = mecs::ThreadPool;
+#endif // !MECS_THREAD_POOL_DECL
+
 // ===========================================================
 // ALIASES & TYPEDEFS
 // ===========================================================
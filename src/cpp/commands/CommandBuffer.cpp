@@ -0,0 +1,202 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef MECS_COMMAND_BUFFER_HPP
+#include "CommandBuffer.hpp"
+#endif // !MECS_COMMAND_BUFFER_HPP
+
+// Include mecs::Entity
+#ifndef MECS_ENTITY_HPP
+#include "../entities/Entity.hpp"
+#endif // !MECS_ENTITY_HPP
+
+// ===========================================================
+// mecs::CommandBuffer
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CommandBuffer constructor.
+	 *
+	 * @throws - no exceptions.
+	**/
+	CommandBuffer::CommandBuffer( ) noexcept
+		: mCommands( )
+	{
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CommandBuffer destructor.
+	 *
+	 * @throws - no exceptions.
+	**/
+	CommandBuffer::~CommandBuffer( ) noexcept = default;
+
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+
+	/**
+	 * Returns 'true' if no Commands recorded.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	bool CommandBuffer::empty( ) const noexcept
+	{ return( mCommands.empty( ) ); }
+
+	/**
+	 * Returns number of recorded Commands.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	std::size_t CommandBuffer::size( ) const noexcept
+	{ return( mCommands.size( ) ); }
+
+	/**
+	 * Returns recorded Commands.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	CommandBuffer::commands_vector_t & CommandBuffer::getCommands( ) noexcept
+	{ return( mCommands ); }
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Record adding Entity to EntitiesManager.
+	 *
+	 * @thread_safety - not thread-safe, no locks used.
+	 * @param pEntity - Entity.
+	 * @throws - no exceptions.
+	**/
+	void CommandBuffer::addEntity( entity_ptr_t & pEntity ) noexcept
+	{
+
+		// Record Command
+		mCommands.push_back( Command{ CommandType::ADD_ENTITY, pEntity->mTypeID, pEntity->mID, INVALID_TYPE_ID, pEntity, component_ptr_t( nullptr ) } );
+
+	}
+
+	/**
+	 * Record removing Entity from EntitiesManager (see EntitiesManager::destroyEntity).
+	 *
+	 * @thread_safety - not thread-safe, no locks used.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pID - Entity-ID.
+	 * @throws - no exceptions.
+	**/
+	void CommandBuffer::removeEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept
+	{
+
+		// Record Command
+		mCommands.push_back( Command{ CommandType::REMOVE_ENTITY, pTypeID, pID, INVALID_TYPE_ID, entity_ptr_t( nullptr ), component_ptr_t( nullptr ) } );
+
+	}
+
+	/**
+	 * Record attaching Component to Entity.
+	 *
+	 * @thread_safety - not thread-safe, no locks used.
+	 * @param pEntity - Entity.
+	 * @param pTypeID - Component Type-ID.
+	 * @param pComponent - Component.
+	 * @throws - no exceptions.
+	**/
+	void CommandBuffer::attachComponent( entity_ptr_t & pEntity, const TypeID & pTypeID, component_ptr_t & pComponent ) noexcept
+	{
+
+		// Record Command
+		mCommands.push_back( Command{ CommandType::ATTACH_COMPONENT, pEntity->mTypeID, pEntity->mID, pTypeID, pEntity, pComponent } );
+
+	}
+
+	/**
+	 * Record detaching Component from Entity.
+	 *
+	 * @thread_safety - not thread-safe, no locks used.
+	 * @param pEntity - Entity.
+	 * @param pTypeID - Component Type-ID.
+	 * @throws - no exceptions.
+	**/
+	void CommandBuffer::detachComponent( entity_ptr_t & pEntity, const TypeID & pTypeID ) noexcept
+	{
+
+		// Record Command
+		mCommands.push_back( Command{ CommandType::DETACH_COMPONENT, pEntity->mTypeID, pEntity->mID, pTypeID, pEntity, component_ptr_t( nullptr ) } );
+
+	}
+
+	/**
+	 * Remove all recorded Commands, keeping allocated memory.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void CommandBuffer::clear( ) noexcept
+	{
+
+		// Remove Commands
+		mCommands.clear( );
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,291 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_COMMAND_BUFFER_HPP
+#define MECS_COMMAND_BUFFER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::CommandType
+	// ===========================================================
+
+	/** Structural Command Type. **/
+	enum class CommandType : std::uint8_t
+	{
+
+		/** Add Entity to EntitiesManager. **/
+		ADD_ENTITY = 0,
+
+		/** Remove Entity from EntitiesManager & retire it. **/
+		REMOVE_ENTITY = 1,
+
+		/** Attach Component to Entity. **/
+		ATTACH_COMPONENT = 2,
+
+		/** Detach Component from Entity. **/
+		DETACH_COMPONENT = 3
+
+	}; // mecs::CommandType
+
+	// ===========================================================
+	// mecs::CommandBuffer
+	// ===========================================================
+
+	/**
+	 * CommandBuffer - records structural changes (Entities & Components) without
+	 * any thread-lock, to apply them later at sync-point via CommandsManager.
+	 * 
+	 * (?) CommandBuffer is owned by one thread (or System) at a time, so recording
+	 * doesn't require synchronization.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class CommandBuffer final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for Entity pointer. **/
+		using entity_ptr_t = mecs_shared<Entity>;
+
+		/** Type-alias for Component pointer. **/
+		using component_ptr_t = mecs_shared<Component>;
+
+		/**
+		 * Command - recorded structural change.
+		**/
+		struct Command
+		{
+
+			/** Command Type. **/
+			CommandType mType;
+
+			/** Entity Type-ID. **/
+			TypeID mEntityTypeID;
+
+			/** Entity-ID. **/
+			ObjectID mEntityID;
+
+			/** Component Type-ID. INVALID_TYPE_ID for Entity Commands. **/
+			TypeID mComponentTypeID;
+
+			/** Entity. **/
+			entity_ptr_t mEntity;
+
+			/** Component. **/
+			component_ptr_t mComponent;
+
+		}; // mecs::CommandBuffer::Command
+
+		/** Type-alias for Commands vector. **/
+		using commands_vector_t = mecs_vector<Command>;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CommandBuffer constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit CommandBuffer( ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CommandBuffer destructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~CommandBuffer( ) noexcept;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns 'true' if no Commands recorded.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		bool empty( ) const noexcept;
+
+		/**
+		 * Returns number of recorded Commands.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		std::size_t size( ) const noexcept;
+
+		/**
+		 * Returns recorded Commands.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		commands_vector_t & getCommands( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Record adding Entity to EntitiesManager.
+		 *
+		 * @thread_safety - not thread-safe, no locks used.
+		 * @param pEntity - Entity.
+		 * @throws - no exceptions.
+		**/
+		void addEntity( entity_ptr_t & pEntity ) noexcept;
+
+		/**
+		 * Record removing Entity from EntitiesManager (see EntitiesManager::destroyEntity).
+		 *
+		 * @thread_safety - not thread-safe, no locks used.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pID - Entity-ID.
+		 * @throws - no exceptions.
+		**/
+		void removeEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept;
+
+		/**
+		 * Record attaching Component to Entity.
+		 *
+		 * @thread_safety - not thread-safe, no locks used.
+		 * @param pEntity - Entity.
+		 * @param pTypeID - Component Type-ID.
+		 * @param pComponent - Component.
+		 * @throws - no exceptions.
+		**/
+		void attachComponent( entity_ptr_t & pEntity, const TypeID & pTypeID, component_ptr_t & pComponent ) noexcept;
+
+		/**
+		 * Record detaching Component from Entity.
+		 *
+		 * @thread_safety - not thread-safe, no locks used.
+		 * @param pEntity - Entity.
+		 * @param pTypeID - Component Type-ID.
+		 * @throws - no exceptions.
+		**/
+		void detachComponent( entity_ptr_t & pEntity, const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Remove all recorded Commands, keeping allocated memory.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		void clear( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Commands. **/
+		commands_vector_t mCommands;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted CommandBuffer const copy constructor */
+		CommandBuffer( const CommandBuffer & ) = delete;
+
+		/* @deleted CommandBuffer const copy assignment operator */
+		CommandBuffer & operator=( const CommandBuffer & ) = delete;
+
+		/* @deleted CommandBuffer move constructor */
+		CommandBuffer( CommandBuffer && ) = delete;
+
+		/* @deleted CommandBuffer move assignment operator */
+		CommandBuffer & operator=( CommandBuffer && ) = delete;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::CommandBuffer
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_COMMAND_BUFFER_DECL
+#define MECS_COMMAND_BUFFER_DECL
+using mecs_CommandBuffer = mecs::CommandBuffer;
+#endif // !MECS_COMMAND_BUFFER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_COMMAND_BUFFER_HPP
@@ -0,0 +1,439 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef MECS_COMMANDS_MANAGER_HPP
+#include "CommandsManager.hpp"
+#endif // !MECS_COMMANDS_MANAGER_HPP
+
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include mecs::Entity
+#ifndef MECS_ENTITY_HPP
+#include "../entities/Entity.hpp"
+#endif // !MECS_ENTITY_HPP
+
+// Include mecs::EntitiesManager
+#ifndef MECS_ENTITIES_MANAGER_HPP
+#include "../entities/EntitiesManager.hpp"
+#endif // !MECS_ENTITIES_MANAGER_HPP
+
+// Include mecs::ECSEngine
+#ifndef MECS_ECS_HPP
+#include "../ecs.hpp"
+#endif // !MECS_ECS_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// mecs::CommandsManager
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CommandsManager constructor.
+	 *
+	 * @throws - no exceptions.
+	**/
+	CommandsManager::CommandsManager( ) noexcept
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		: mMutex( ),
+		mThreadBuffers( ),
+#else // ONE-THREAD
+		: mThreadBuffer( ),
+#endif // MULTI-THREADING
+		mID( generateID( ) ),
+		mBuffers( ),
+		mPlayback( )
+	{
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CommandsManager destructor.
+	 *
+	 * @throws - no exceptions.
+	**/
+	CommandsManager::~CommandsManager( ) noexcept
+	{
+
+		// Discard Commands, threads may keep cached CommandBuffers.
+		for ( command_buffer_ptr_t & buffer_lr : mBuffers )
+			buffer_lr->clear( );
+
+	}
+
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+
+	/**
+	 * Returns CommandsManager of the current World (see World::getCurrent).
+	 *
+	 * @thread_safety - thread-local used.
+	 * @return - CommandsManager, or null.
+	 * @throws - no exceptions.
+	**/
+	CommandsManager * CommandsManager::getInstance( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Return CommandsManager
+		return( world_ != nullptr ? world_->mCommandsManager : nullptr );
+
+	}
+
+	/**
+	 * Generate unique CommandsManager ID.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @return - ID, greater than 0.
+	 * @throws - no exceptions.
+	**/
+	std::uint64_t CommandsManager::generateID( ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Last ID.
+		static mecs_atomic<std::uint64_t> lastID_( 0 );
+
+		return( lastID_.fetch_add( 1, std::memory_order_relaxed ) + 1 );
+#else // ONE-THREAD
+		// Last ID.
+		static std::uint64_t lastID_( 0 );
+
+		return( ++lastID_ );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Returns CommandBuffer of the calling thread. CommandBuffer created
+	 * & registered on first call, & cached by thread.
+	 *
+	 * @thread_safety - thread-local used, thread-lock used on first call.
+	 * @return - CommandBuffer.
+	 * @throws - no exceptions.
+	**/
+	const CommandsManager::command_buffer_ptr_t & CommandsManager::getCommandBuffer( ) noexcept
+	{
+
+		// CommandsManager of the current World.
+		CommandsManager * const instance_( getInstance( ) );
+
+		// CommandBuffer of the calling thread, for the last used CommandsManager.
+		static thread_local ThreadBuffer cache_;
+
+		// Return cached CommandBuffer
+		if ( cache_.mManagerID == instance_->mID )
+			return( cache_.mBuffer );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mMutex );
+
+		// Get thread CommandBuffer.
+		command_buffer_ptr_t & buffer_lr = instance_->mThreadBuffers[std::this_thread::get_id( )];
+#else // ONE-THREAD
+		// Get thread CommandBuffer.
+		command_buffer_ptr_t & buffer_lr = instance_->mThreadBuffer;
+#endif // MULTI-THREADING
+
+		// Create & register CommandBuffer
+		if ( buffer_lr == nullptr )
+		{
+			buffer_lr = std::make_shared<CommandBuffer>( );
+			instance_->mBuffers.push_back( buffer_lr );
+		}
+
+		// Cache CommandBuffer
+		cache_.mManagerID = instance_->mID;
+		cache_.mBuffer = buffer_lr;
+
+		// Return CommandBuffer
+		return( cache_.mBuffer );
+
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Initialize CommandsManager.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::Initialize( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Cancel
+		if ( world_ == nullptr || world_->mCommandsManager != nullptr )
+			return;
+
+		// Create CommandsManager instance.
+		world_->mCommandsManager = new CommandsManager( );
+
+	}
+
+	/**
+	 * Terminate CommandsManager.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::Terminate( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Cancel
+		if ( world_ == nullptr || world_->mCommandsManager == nullptr )
+			return;
+
+		// Delete CommandsManager instance.
+		delete world_->mCommandsManager;
+		world_->mCommandsManager = nullptr;
+
+	}
+
+	/**
+	 * Register CommandBuffer (owned by System, or other single owner).
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pBuffer - CommandBuffer.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::registerCommandBuffer( command_buffer_ptr_t & pBuffer ) noexcept
+	{
+
+		// CommandsManager of the current World.
+		CommandsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mMutex );
+#endif // MULTI-THREADING
+
+		// Add CommandBuffer
+		instance_->mBuffers.push_back( pBuffer );
+
+	}
+
+	/**
+	 * Unregister CommandBuffer. Recorded Commands are discarded.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pBuffer - CommandBuffer.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::unregisterCommandBuffer( command_buffer_ptr_t & pBuffer ) noexcept
+	{
+
+		// CommandsManager of the current World.
+		CommandsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mMutex );
+#endif // MULTI-THREADING
+
+		// Search CommandBuffer
+		auto bufferPos_ = std::find( instance_->mBuffers.begin( ), instance_->mBuffers.end( ), pBuffer );
+
+		// Cancel
+		if ( bufferPos_ == instance_->mBuffers.end( ) )
+			return;
+
+		// Discard Commands
+		pBuffer->clear( );
+
+		// Remove CommandBuffer, keeping registration order.
+		instance_->mBuffers.erase( bufferPos_ );
+
+	}
+
+	/**
+	 * Apply Command.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pCommand - Command.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::execute( CommandBuffer::Command & pCommand ) noexcept
+	{
+
+		switch ( pCommand.mType )
+		{
+
+		case CommandType::ADD_ENTITY:
+			EntitiesManager::addEntity( pCommand.mEntityTypeID, pCommand.mEntity );
+			break;
+
+		case CommandType::REMOVE_ENTITY:
+			EntitiesManager::destroyEntity( pCommand.mEntityTypeID, pCommand.mEntityID );
+			break;
+
+		case CommandType::ATTACH_COMPONENT:
+			pCommand.mEntity->attachComponent( pCommand.mComponentTypeID, pCommand.mComponent );
+			break;
+
+		case CommandType::DETACH_COMPONENT:
+			pCommand.mEntity->detachComponent( pCommand.mComponentTypeID );
+			break;
+
+		}
+
+	}
+
+	/**
+	 * Returns playback sort-key of Command: Entity Type-ID & Entity-ID.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pCommand - Command.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t CommandsManager::getPlaybackKey( const CommandBuffer::Command & pCommand ) noexcept
+	{
+
+		// Commands of the same Entity are equal, so merge-order keeps their recorded order.
+		return( ( static_cast<std::uint32_t>( pCommand.mEntityTypeID ) << 16 ) | static_cast<std::uint32_t>( pCommand.mEntityID ) );
+
+	}
+
+	/**
+	 * Merge & apply all recorded Commands, then clear CommandBuffers &
+	 * reclaim retired objects (see ECSEngine::reclaim).
+	 *
+	 * (!) Sync-point: no thread is allowed to record Commands during playback.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @throws - no exceptions.
+	**/
+	void CommandsManager::playback( ) noexcept
+	{
+
+		// CommandsManager of the current World.
+		CommandsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mMutex );
+#endif // MULTI-THREADING
+
+		// Playback entries.
+		playback_vector_t & playback_lr = instance_->mPlayback;
+
+		// Merge Commands, in CommandBuffers registration order.
+		for ( command_buffer_ptr_t & buffer_lr : instance_->mBuffers )
+		{
+
+			// Commands
+			CommandBuffer::commands_vector_t & commands_lr = buffer_lr->getCommands( );
+
+			// Add Commands
+			for ( CommandBuffer::Command & command_lr : commands_lr )
+				playback_lr.push_back( PlaybackEntry{ getPlaybackKey( command_lr ), static_cast<std::uint32_t>( playback_lr.size( ) ), &command_lr } );
+
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Remove CommandBuffers of finished threads (owned only by CommandsManager).
+		for ( auto threadBuffer_ = instance_->mThreadBuffers.begin( ); threadBuffer_ != instance_->mThreadBuffers.end( ); )
+		{
+			if ( threadBuffer_->second.use_count( ) <= 2 && threadBuffer_->second->getCommands( ).empty( ) )
+				threadBuffer_ = instance_->mThreadBuffers.erase( threadBuffer_ );
+			else
+				threadBuffer_++;
+		}
+#endif // MULTI-THREADING
+
+		// Remove not used CommandBuffers (registration order kept), their Commands are applied.
+		instance_->mBuffers.erase( std::remove_if( instance_->mBuffers.begin( ), instance_->mBuffers.end( ),
+			[]( const command_buffer_ptr_t & pBuffer ) { return( pBuffer.use_count( ) == 1 && pBuffer->getCommands( ).empty( ) ); } ),
+			instance_->mBuffers.end( ) );
+
+		// Sort by Entities, keeping merge-order of each Entity Commands.
+		std::sort( playback_lr.begin( ), playback_lr.end( ), []( const PlaybackEntry & pA, const PlaybackEntry & pB )
+		{ return( pA.mKey < pB.mKey || ( pA.mKey == pB.mKey && pA.mOrder < pB.mOrder ) ); } );
+
+		// Apply Commands
+		for ( PlaybackEntry & entry_lr : playback_lr )
+			execute( *entry_lr.mCommand );
+
+		// Clear Playback entries.
+		playback_lr.clear( );
+
+		// Clear CommandBuffers
+		for ( command_buffer_ptr_t & buffer_lr : instance_->mBuffers )
+			buffer_lr->clear( );
+
+		// Reclaim retired Entities & Components.
+		ECSEngine::reclaim( );
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// -----------------------------------------------------------
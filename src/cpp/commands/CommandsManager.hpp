@@ -0,0 +1,330 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_COMMANDS_MANAGER_HPP
+#define MECS_COMMANDS_MANAGER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include mecs::CommandBuffer
+#ifndef MECS_COMMAND_BUFFER_HPP
+#include "CommandBuffer.hpp"
+#endif // !MECS_COMMAND_BUFFER_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::CommandsManager
+	// ===========================================================
+
+	/**
+	 * CommandsManager - stores CommandBuffers (one per thread, or per System) & plays
+	 * them back at sync-point.
+	 * 
+	 * (?) Playback order is defined: Commands are merged in CommandBuffers registration order,
+	 * then sorted (stable) by Entity Type-ID & Entity-ID, so Commands of the same Entities
+	 * type are applied together. Commands of one Entity keep recorded order (e.g. remove
+	 * & re-add of recycled Entity), Commands of one Entity recorded to different
+	 * CommandBuffers keep merge-order.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class CommandsManager final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for CommandBuffer pointer. **/
+		using command_buffer_ptr_t = mecs_shared<CommandBuffer>;
+
+		/** Type-alias for CommandBuffers vector. **/
+		using command_buffers_vector_t = mecs_vector<command_buffer_ptr_t>;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Type-alias for threads CommandBuffers map. **/
+		using thread_buffers_map_t = mecs_map<mecs_thread_id, command_buffer_ptr_t>;
+#endif // MULTI-THREADING
+
+		/**
+		 * ThreadBuffer - CommandBuffer of the thread, cached for one CommandsManager.
+		**/
+		struct ThreadBuffer
+		{
+
+			/** CommandsManager ID (see mID), 0 if not cached. **/
+			std::uint64_t mManagerID;
+
+			/** CommandBuffer. **/
+			command_buffer_ptr_t mBuffer;
+
+		}; // mecs::CommandsManager::ThreadBuffer
+
+		/**
+		 * PlaybackEntry - sort-key & recorded Command.
+		**/
+		struct PlaybackEntry
+		{
+
+			/** Sort-key (see getPlaybackKey). **/
+			std::uint32_t mKey;
+
+			/** Merge-order. **/
+			std::uint32_t mOrder;
+
+			/** Command. **/
+			CommandBuffer::Command * mCommand;
+
+		}; // mecs::CommandsManager::PlaybackEntry
+
+		/** Type-alias for Playback vector. **/
+		using playback_vector_t = mecs_vector<PlaybackEntry>;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Mutex. **/
+		mecs_mutex mMutex;
+
+		/** Threads CommandBuffers. **/
+		thread_buffers_map_t mThreadBuffers;
+#else // ONE-THREAD
+		/** Thread CommandBuffer. **/
+		command_buffer_ptr_t mThreadBuffer;
+#endif // MULTI-THREADING
+
+		/** Unique ID, to validate threads CommandBuffers cache. **/
+		const std::uint64_t mID;
+
+		/** CommandBuffers, in registration order. **/
+		command_buffers_vector_t mBuffers;
+
+		/** Playback entries (reused). **/
+		playback_vector_t mPlayback;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CommandsManager constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit CommandsManager( ) noexcept;
+
+		/**
+		 * Returns CommandsManager of the current World (see World::getCurrent).
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - CommandsManager, or null.
+		 * @throws - no exceptions.
+		**/
+		static CommandsManager * getInstance( ) noexcept;
+
+		/**
+		 * Generate unique CommandsManager ID.
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @return - ID, greater than 0.
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t generateID( ) noexcept;
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class World;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Apply Command.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pCommand - Command.
+		 * @throws - no exceptions.
+		**/
+		static void execute( CommandBuffer::Command & pCommand ) noexcept;
+
+		/**
+		 * Returns playback sort-key of Command: Entity Type-ID & Entity-ID.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pCommand - Command.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getPlaybackKey( const CommandBuffer::Command & pCommand ) noexcept;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted CommandsManager const copy constructor */
+		CommandsManager( const CommandsManager & ) = delete;
+
+		/* @deleted CommandsManager const copy assignment operator */
+		CommandsManager & operator=( const CommandsManager & ) = delete;
+
+		/* @deleted CommandsManager move constructor */
+		CommandsManager( CommandsManager && ) = delete;
+
+		/* @deleted CommandsManager move assignment operator */
+		CommandsManager & operator=( CommandsManager && ) = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CommandsManager destructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~CommandsManager( ) noexcept;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns CommandBuffer of the calling thread. CommandBuffer created
+		 * & registered on first call, & cached by thread.
+		 * 
+		 * (?) CommandBuffers of finished threads are removed by playback.
+		 *
+		 * @thread_safety - thread-local used, thread-lock used on first call.
+		 * @return - CommandBuffer.
+		 * @throws - no exceptions.
+		**/
+		static const command_buffer_ptr_t & getCommandBuffer( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Initialize CommandsManager.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		static void Initialize( ) noexcept;
+
+		/**
+		 * Terminate CommandsManager.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		static void Terminate( ) noexcept;
+
+		/**
+		 * Register CommandBuffer (owned by System, or other single owner).
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pBuffer - CommandBuffer.
+		 * @throws - no exceptions.
+		**/
+		static void registerCommandBuffer( command_buffer_ptr_t & pBuffer ) noexcept;
+
+		/**
+		 * Unregister CommandBuffer. Recorded Commands are discarded.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pBuffer - CommandBuffer.
+		 * @throws - no exceptions.
+		**/
+		static void unregisterCommandBuffer( command_buffer_ptr_t & pBuffer ) noexcept;
+
+		/**
+		 * Merge & apply all recorded Commands, then clear CommandBuffers,
+		 * remove not used ones, & reclaim retired objects (see ECSEngine::reclaim).
+		 * 
+		 * (!) Sync-point: no thread is allowed to record Commands during playback.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		static void playback( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::CommandsManager
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_COMMANDS_MANAGER_DECL
+#define MECS_COMMANDS_MANAGER_DECL
+using mecs_CommandsManager = mecs::CommandsManager;
+#endif // !MECS_COMMANDS_MANAGER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_COMMANDS_MANAGER_HPP
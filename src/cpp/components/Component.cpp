@@ -42,6 +42,11 @@
 #include "Component.hpp"
 #endif // !MECS_COMPONENT_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
 // ===========================================================
 // mecs::Component
 // ===========================================================
@@ -51,13 +56,6 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-
-	/** Components IDs Cache. **/
-	IDMap<const TypeID, ObjectID> Component::mComponentsIDs;
-	
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -70,8 +68,9 @@ namespace mecs
 	**/
 	Component::Component( const TypeID & pType ) noexcept
 		: mTypeID( pType ),
-		mID( mComponentsIDs.generateID( pType ) ),
-		mRemove( false )
+		mID( World::getCurrentComponentsIDs( ).generateID( pType ) ),
+		mRemove( false ),
+		mComponentsIDs( &World::getCurrentComponentsIDs( ) )
 	{
 	}
 
@@ -88,7 +87,7 @@ namespace mecs
 	{
 
 		// Return ID
-		mComponentsIDs.returnID( mTypeID, mID );
+		mComponentsIDs->returnID( mTypeID, mID );
 
 	}
 
@@ -133,8 +133,8 @@ namespace mecs
 		// FIELDS
 		// ===========================================================
 
-		/** Components IDs Cache. **/
-		static IDMap<const TypeID, ObjectID> mComponentsIDs;
+		/** Components IDs Cache (of World, where Component was created). **/
+		IDMap<const TypeID, ObjectID> * const mComponentsIDs;
 
 		// ===========================================================
 		// DELETED
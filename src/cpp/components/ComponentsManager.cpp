@@ -42,11 +42,21 @@
 #include "ComponentsManager.hpp"
 #endif // !MECS_COMPONENTS_MANAGER_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
 // Include mecs::Component
 #ifndef MECS_COMPONENT_HPP
 #include "Component.hpp"
 #endif // !MECS_COMPONENT_HPP
 
+// Include mecs::ComponentsStorage
+#ifndef MECS_COMPONENTS_STORAGE_HPP
+#include "ComponentsStorage.hpp"
+#endif // !MECS_COMPONENTS_STORAGE_HPP
+
 // ===========================================================
 // mecs::ComponentsManager
 // ===========================================================
@@ -56,13 +66,6 @@ namespace mecs
 	
 	// -----------------------------------------------------------
 	
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-	
-	/** ComponentsManager instance. **/
-	ComponentsManager * ComponentsManager::mInstance( nullptr );
-	
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -92,6 +95,28 @@ namespace mecs
 	**/ 
 	ComponentsManager::~ComponentsManager( ) noexcept = default;
 
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+	
+	/**
+	 * Returns ComponentsManager of the current World (see World::getCurrent).
+	 *
+	 * @thread_safety - thread-local used.
+	 * @return - ComponentsManager, or null.
+	 * @throws - no exceptions.
+	**/
+	ComponentsManager * ComponentsManager::getInstance( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Return ComponentsManager
+		return( world_ != nullptr ? world_->mComponentsManager : nullptr );
+
+	}
+	
 	// ===========================================================
 	// METHODS
 	// ===========================================================
@@ -105,12 +130,15 @@ namespace mecs
 	void ComponentsManager::Initialize( ) noexcept
 	{
 		
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+		
 		// Cancel
-		if ( mInstance != nullptr )
+		if ( world_ == nullptr || world_->mComponentsManager != nullptr )
 			return;
 		
 		// Create ComponentsManager instance.
-		mInstance = new ComponentsManager( );
+		world_->mComponentsManager = new ComponentsManager( );
 		
 	}
 
@@ -123,13 +151,16 @@ namespace mecs
 	void ComponentsManager::Terminate( ) noexcept
 	{
 		
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+		
 		// Cancel
-		if ( mInstance == nullptr )
+		if ( world_ == nullptr || world_->mComponentsManager == nullptr )
 			return;
 		
 		// Delete ComponentsManager instance.
-		delete mInstance;
-		mInstance = nullptr;
+		delete world_->mComponentsManager;
+		world_->mComponentsManager = nullptr;
 		
 	}
 
@@ -144,16 +175,19 @@ namespace mecs
 	ComponentsManager::component_ptr ComponentsManager::getComponent( const TypeID & pTypeID ) noexcept
 	{
 		
+		// ComponentsManager of the current World.
+		ComponentsManager * const instance_( getInstance( ) );
+		
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_l( mInstance->mComponentsMutex );
+		mecs_ulock lock_l( instance_->mComponentsMutex );
 #endif // MULTI-THREADING
 		
 		// Search
-		auto component_position_l = mInstance->mComponents.find( pTypeID );
+		auto component_position_l = instance_->mComponents.find( pTypeID );
 		
 		// Cancel
-		if ( component_position_l == mInstance->mComponents.cend( ) )
+		if ( component_position_l == instance_->mComponents.cend( ) )
 			return( component_ptr( nullptr ) );
 		
 		// Components vector.
@@ -183,13 +217,16 @@ namespace mecs
 	void ComponentsManager::addComponent( const TypeID &pTypeID, ComponentsManager::component_ptr & pComponent ) noexcept
 	{
 		
+		// ComponentsManager of the current World.
+		ComponentsManager * const instance_( getInstance( ) );
+		
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_l( mInstance->mComponentsMutex );
+		mecs_ulock lock_l( instance_->mComponentsMutex );
 #endif // MULTI-THREADING
 		
 		// Get Components vector.
-		components_vector & componentsVector_lr = mInstance->mComponents[pTypeID];
+		components_vector & componentsVector_lr = instance_->mComponents[pTypeID];
 		
 		// Add Component
 		componentsVector_lr.push_back( pComponent );
@@ -206,23 +243,33 @@ namespace mecs
 	void ComponentsManager::clear( const TypeID & pTypeID ) noexcept
 	{
 		
+		// ComponentsManager of the current World.
+		ComponentsManager * const instance_( getInstance( ) );
+		
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_l( mInstance->mComponentsMutex );
+		mecs_ulock lock_l( instance_->mComponentsMutex );
 #endif // MULTI-THREADING
 		
 		// Search
-		auto component_position_l = mInstance->mComponents.find( pTypeID );
+		auto component_position_l = instance_->mComponents.find( pTypeID );
 		
 		// Cancel
-		if ( component_position_l == mInstance->mComponents.cend( ) )
+		if ( component_position_l == instance_->mComponents.cend( ) )
 			return;
 		
 		// Delete (erase) Components vector.
-		mInstance->mComponents.erase( component_position_l );
+		instance_->mComponents.erase( component_position_l );
 		
 	}
 
+	// ===========================================================
+	// mecs::ComponentsStorage
+	// ===========================================================
+
+	/** ComponentsStorage of base Components, compiled with the library. **/
+	template class ComponentsStorage<Component>;
+
 	// -----------------------------------------------------------
 	
 } // mecs
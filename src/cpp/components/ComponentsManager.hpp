@@ -97,9 +97,6 @@ namespace mecs
 		mecs_mutex mComponentsMutex;
 #endif // MULTI-THREADING
 		
-		/** ComponentsManager instance. **/
-		static ComponentsManager * mInstance;
-		
 		/** Components map. **/
 		components_map mComponents;
 		
@@ -114,6 +111,21 @@ namespace mecs
 		**/
 		explicit ComponentsManager( ) noexcept;
 		
+		/**
+		 * Returns ComponentsManager of the current World (see World::getCurrent).
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - ComponentsManager, or null.
+		 * @throws - no exceptions.
+		**/
+		static ComponentsManager * getInstance( ) noexcept;
+		
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+		
+		friend class World;
+		
 		// ===========================================================
 		// DELETED
 		// ===========================================================
@@ -0,0 +1,613 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_COMPONENTS_STORAGE_HPP
+#define MECS_COMPONENTS_STORAGE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// Include mecs::Component
+#ifndef MECS_COMPONENT_HPP
+#include "Component.hpp"
+#endif // !MECS_COMPONENT_HPP
+
+// Include mecs::ThreadPool
+#ifndef MECS_THREAD_POOL_HPP
+#include "../utils/ThreadPool.hpp"
+#endif // !MECS_THREAD_POOL_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ functional
+#include <functional>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::ComponentsStorage
+	// ===========================================================
+
+	/**
+	 * ComponentsStorage - dense (packed) storage of Components of one Type-ID, with
+	 * sparse index by Component-ID. Used by Systems to iterate Components.
+	 * 
+	 * (?) Components can be sorted (grouped) by user key, like Morton-code of position,
+	 * to iterate neighbours together. Sort is stable & can run incrementally across frames.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	template <typename T = Component>
+	class ComponentsStorage final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for Component pointer. **/
+		using component_ptr_t = mecs_shared<T>;
+
+		/** Type-alias for Components vector. **/
+		using components_vector_t = mecs_vector<component_ptr_t>;
+
+		/** Type-alias for sort-key. **/
+		using sort_key_t = std::uint64_t;
+
+		/** Type-alias for sort-key function. **/
+		using sort_key_fn_t = std::function<sort_key_t( const T & )>;
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Invalid dense index. **/
+		static constexpr const std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max( );
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for indices vector. **/
+		using indices_vector_t = mecs_vector<std::uint32_t>;
+
+		/** Type-alias for sort-keys vector. **/
+		using keys_vector_t = mecs_vector<sort_key_t>;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Components (dense). **/
+		components_vector_t mComponents;
+
+		/** Dense indices by Component-ID (sparse). **/
+		indices_vector_t mIndices;
+
+		/** Sort-keys, parallel to Components, while sorting. **/
+		keys_vector_t mKeys;
+
+		/** Sort-key function of incremental sort. **/
+		sort_key_fn_t mKeyFn;
+
+		/** Incremental sort: Components before cursor are sorted. **/
+		std::size_t mSortCursor;
+
+		/** Incremental sort: position of Component, being inserted. **/
+		std::size_t mSortPosition;
+
+		/** Incremental sort is in progress. **/
+		bool mSorting;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Swap two Components & update indices.
+		 *
+		 * @param pA - dense index.
+		 * @param pB - dense index.
+		 * @throws - no exceptions.
+		**/
+		void swapComponents( const std::size_t pA, const std::size_t pB ) noexcept
+		{
+
+			// Swap Components
+			std::swap( mComponents[pA], mComponents[pB] );
+
+			// Update indices
+			mIndices[mComponents[pA]->mID] = static_cast<std::uint32_t>( pA );
+			mIndices[mComponents[pB]->mID] = static_cast<std::uint32_t>( pB );
+
+			// Swap sort-keys
+			if ( mSorting )
+				std::swap( mKeys[pA], mKeys[pB] );
+
+		}
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted ComponentsStorage const copy constructor */
+		ComponentsStorage( const ComponentsStorage & ) = delete;
+
+		/* @deleted ComponentsStorage const copy assignment operator */
+		ComponentsStorage & operator=( const ComponentsStorage & ) = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * ComponentsStorage constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit ComponentsStorage( ) noexcept
+			: mComponents( ),
+			mIndices( ),
+			mKeys( ),
+			mKeyFn( ),
+			mSortCursor( 0 ),
+			mSortPosition( 0 ),
+			mSorting( false )
+		{
+		}
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * ComponentsStorage destructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~ComponentsStorage( ) noexcept = default;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of Components.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		std::size_t size( ) const noexcept
+		{ return( mComponents.size( ) ); }
+
+		/**
+		 * Returns 'true' if storage is empty.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		bool empty( ) const noexcept
+		{ return( mComponents.empty( ) ); }
+
+		/**
+		 * Returns Component at dense index.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pIndex - dense index.
+		 * @throws - no exceptions.
+		**/
+		T & operator[]( const std::size_t pIndex ) noexcept
+		{ return( *mComponents[pIndex] ); }
+
+		/**
+		 * Returns Components (dense), in iteration order.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		components_vector_t & getComponents( ) noexcept
+		{ return( mComponents ); }
+
+		/**
+		 * Returns dense index of Component, or INVALID_INDEX.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pID - Component-ID.
+		 * @throws - no exceptions.
+		**/
+		std::uint32_t indexOf( const ObjectID & pID ) const noexcept
+		{ return( pID < mIndices.size( ) ? mIndices[pID] : INVALID_INDEX ); }
+
+		/**
+		 * Search Component.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pID - Component-ID.
+		 * @return - Component, or null.
+		 * @throws - no exceptions.
+		**/
+		T * get( const ObjectID & pID ) noexcept
+		{
+
+			// Dense index.
+			const std::uint32_t index_( indexOf( pID ) );
+
+			// Return Component
+			return( index_ == INVALID_INDEX ? nullptr : mComponents[index_].get( ) );
+
+		}
+
+		/**
+		 * Returns 'true' if incremental sort is in progress.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		bool isSorting( ) const noexcept
+		{ return( mSorting ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Add Component. Component is added to the end (iteration order).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pComponent - Component.
+		 * @return - 'false' if Component with same ID already stored.
+		 * @throws - no exceptions.
+		**/
+		bool add( const component_ptr_t & pComponent ) noexcept
+		{
+
+			// Component-ID.
+			const ObjectID id_( pComponent->mID );
+
+			// Grow sparse indices.
+			if ( id_ >= mIndices.size( ) )
+				mIndices.resize( static_cast<std::size_t>( id_ ) + 1, INVALID_INDEX );
+
+			// Cancel
+			if ( mIndices[id_] != INVALID_INDEX )
+				return( false );
+
+			// Add Component
+			mIndices[id_] = static_cast<std::uint32_t>( mComponents.size( ) );
+			mComponents.push_back( pComponent );
+
+			// Add sort-key
+			if ( mSorting )
+				mKeys.push_back( mKeyFn( *pComponent ) );
+
+			// Return OK
+			return( true );
+
+		}
+
+		/**
+		 * Remove Component. Last Component takes its place.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pID - Component-ID.
+		 * @return - removed Component, or null.
+		 * @throws - no exceptions.
+		**/
+		component_ptr_t remove( const ObjectID & pID ) noexcept
+		{
+
+			// Dense index.
+			const std::uint32_t index_( indexOf( pID ) );
+
+			// Cancel
+			if ( index_ == INVALID_INDEX )
+				return( component_ptr_t( nullptr ) );
+
+			// Move Component to the end.
+			const std::size_t last_( mComponents.size( ) - 1 );
+			if ( index_ != last_ )
+				swapComponents( index_, last_ );
+
+			// Remove Component
+			component_ptr_t component_sp( std::move( mComponents.back( ) ) );
+			mComponents.pop_back( );
+			mIndices[pID] = INVALID_INDEX;
+
+			// Update incremental sort
+			if ( mSorting )
+			{
+
+				// Remove sort-key
+				mKeys.pop_back( );
+
+				// Components before moved one (& before inserted one) are still sorted.
+				if ( index_ <= mSortCursor )
+					mSortCursor = mSortPosition = std::min<std::size_t>( index_, mSortPosition );
+
+			}
+
+			// Return Component
+			return( component_sp );
+
+		}
+
+		/**
+		 * Remove all Components. Cancels incremental sort.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		void clear( ) noexcept
+		{
+
+			// Remove Components
+			mComponents.clear( );
+			mIndices.clear( );
+
+			// Cancel sort
+			cancelSort( );
+
+		}
+
+		/**
+		 * Call function for each Component in parallel, splitting dense array
+		 * into cache-sized chunks (see ThreadPool::parallelFor).
+		 *
+		 * @thread_safety - not thread-safe, Components must not be added or removed.
+		 * @param pPool - worker threads (see SystemsManager::getThreadPool).
+		 * @param pFunction - function, called with Component reference.
+		 * @throws - no exceptions.
+		**/
+		template <typename F>
+		void parallelFor( ThreadPool & pPool, const F & pFunction ) noexcept
+		{
+			pPool.parallelFor( 0, mComponents.size( ), ThreadPool::getGrain<T>( ),
+				[this, &pFunction]( const std::size_t pBegin, const std::size_t pEnd )
+				{
+					for ( std::size_t index_ = pBegin; index_ < pEnd; index_++ )
+						pFunction( *mComponents[index_] );
+				} );
+		}
+
+		/**
+		 * Sort Components by key (stable). Cancels incremental sort.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pKeyFn - sort-key function.
+		 * @throws - no exceptions.
+		**/
+		void sort( const sort_key_fn_t & pKeyFn ) noexcept
+		{
+
+			// Cancel incremental sort.
+			cancelSort( );
+
+			// Sort-keys & Components.
+			mecs_vector<std::pair<sort_key_t, component_ptr_t>> sorted_;
+			sorted_.reserve( mComponents.size( ) );
+			for ( component_ptr_t & component_lr : mComponents )
+				sorted_.push_back( std::make_pair( pKeyFn( *component_lr ), std::move( component_lr ) ) );
+
+			// Sort
+			std::stable_sort( sorted_.begin( ), sorted_.end( ),
+				[]( const std::pair<sort_key_t, component_ptr_t> & pA, const std::pair<sort_key_t, component_ptr_t> & pB )
+				{ return( pA.first < pB.first ); } );
+
+			// Store Components & update indices.
+			for ( std::size_t i = 0; i < sorted_.size( ); i++ )
+			{
+				mComponents[i] = std::move( sorted_[i].second );
+				mIndices[mComponents[i]->mID] = static_cast<std::uint32_t>( i );
+			}
+
+		}
+
+		/**
+		 * Start incremental sort (stable). Sort-keys are computed once, call
+		 * sortStep each frame to continue.
+		 * 
+		 * (?) Insertion-sort used, so nearly sorted Components (keys changed
+		 * slightly since previous sort) are sorted in few steps.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pKeyFn - sort-key function.
+		 * @throws - no exceptions.
+		**/
+		void beginSort( const sort_key_fn_t & pKeyFn ) noexcept
+		{
+
+			// Store sort-key function.
+			mKeyFn = pKeyFn;
+
+			// Compute sort-keys.
+			mKeys.clear( );
+			mKeys.reserve( mComponents.size( ) );
+			for ( component_ptr_t & component_lr : mComponents )
+				mKeys.push_back( mKeyFn( *component_lr ) );
+
+			// Start
+			mSortCursor = 0;
+			mSortPosition = 0;
+			mSorting = true;
+
+		}
+
+		/**
+		 * Continue incremental sort.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pMaxMoves - max number of Components moves.
+		 * @return - 'true' if Components are sorted (or no sort in progress).
+		 * @throws - no exceptions.
+		**/
+		bool sortStep( std::size_t pMaxMoves ) noexcept
+		{
+
+			// Cancel
+			if ( !mSorting )
+				return( true );
+
+			// Insertion-sort
+			while ( mSortCursor < mComponents.size( ) )
+			{
+
+				// Component is in place, next Component.
+				if ( mSortPosition == 0 || !( mKeys[mSortPosition] < mKeys[mSortPosition - 1] ) )
+				{
+					mSortCursor++;
+					mSortPosition = mSortCursor;
+					continue;
+				}
+
+				// Stop, continue next time.
+				if ( pMaxMoves == 0 )
+					return( false );
+
+				// Move Component back.
+				swapComponents( mSortPosition, mSortPosition - 1 );
+				mSortPosition--;
+				pMaxMoves--;
+
+			}
+
+			// Complete
+			cancelSort( );
+			return( true );
+
+		}
+
+		/**
+		 * Cancel incremental sort. Components keep current order.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		void cancelSort( ) noexcept
+		{
+
+			// Reset
+			mSorting = false;
+			mKeys.clear( );
+			mSortCursor = 0;
+			mSortPosition = 0;
+
+		}
+
+		// -----------------------------------------------------------
+
+	}; // mecs::ComponentsStorage
+
+	// ===========================================================
+	// MORTON-CODE
+	// ===========================================================
+
+	/**
+	 * Returns 3D Morton-code (Z-order) sort-key, for spatial locality.
+	 * 
+	 * (?) Coordinates should be quantized (grid-cells) & offset to positive range.
+	 *
+	 * @param pX - X (21 lower bits used).
+	 * @param pY - Y (21 lower bits used).
+	 * @param pZ - Z (21 lower bits used).
+	 * @return - Morton-code.
+	 * @throws - no exceptions.
+	**/
+	inline std::uint64_t mortonCode( const std::uint32_t pX, const std::uint32_t pY, const std::uint32_t pZ ) noexcept
+	{
+
+		// Spread 21 bits, leaving 2 zero-bits between each.
+		auto spread_ = []( std::uint64_t pValue ) -> std::uint64_t
+		{
+			pValue &= 0x1FFFFF;
+			pValue = ( pValue | pValue << 32 ) & 0x1F00000000FFFFULL;
+			pValue = ( pValue | pValue << 16 ) & 0x1F0000FF0000FFULL;
+			pValue = ( pValue | pValue << 8 ) & 0x100F00F00F00F00FULL;
+			pValue = ( pValue | pValue << 4 ) & 0x10C30C30C30C30C3ULL;
+			pValue = ( pValue | pValue << 2 ) & 0x1249249249249249ULL;
+			return( pValue );
+		};
+
+		// Interleave
+		return( spread_( pX ) | ( spread_( pY ) << 1 ) | ( spread_( pZ ) << 2 ) );
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+template <typename T = mecs::Component>
+using mecs_ComponentsStorage = mecs::ComponentsStorage<T>;
+
+// -----------------------------------------------------------
+
+#endif // !MECS_COMPONENTS_STORAGE_HPP
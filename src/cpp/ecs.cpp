@@ -42,26 +42,16 @@
 #include "ecs.hpp"
 #endif // !MECS_ECS_HPP
 
-// Include mecs::ComponentsManager
-#ifndef MECS_COMPONENTS_MANAGER_HPP
-#include "components/ComponentsManager.hpp"
-#endif // !MECS_COMPONENTS_MANAGER_HPP
-
-// Include mecs::EntitiesManager
-#ifndef MECS_ENTITiES_MANAGER_HPP
-#include "entities/EntitiesManager.hpp"
-#endif // !MECS_ENTITiES_MANAGER_HPP
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "world/World.hpp"
+#endif // !MECS_WORLD_HPP
 
 // Include mecs::SystemsManager
 #ifndef MECS_SYSTEMS_MANAGER_HPP
 #include "systems/SystemsManager.hpp"
 #endif // !MECS_SYSTEMS_MANAGER_HPP
 
-// Include mecs::EventsManager
-#ifndef MECS_EVENTS_MANAGER_HPP
-#include "events/EventsManager.hpp"
-#endif // !MECS_EVENTS_MANAGER_HPP
-
 // ===========================================================
 // IMPLEMENTATION
 // ===========================================================
@@ -71,6 +61,27 @@ namespace mecs
 	
 	// -----------------------------------------------------------
 	
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+	
+	/**
+	 * Returns EpochReclaimer of the current World, or null if not initialized.
+	 * 
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	EpochReclaimer * ECSEngine::getReclaimer( ) noexcept
+	{
+		
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+		
+		// Return EpochReclaimer
+		return( world_ != nullptr ? &world_->getReclaimer( ) : nullptr );
+		
+	}
+	
 	// ===========================================================
 	// METHODS
 	// ===========================================================
@@ -84,17 +95,8 @@ namespace mecs
 	void ECSEngine::Initialize( ) noexcept
 	{
 		
-		// Initialize ComponentsManager
-		ComponentsManager::Initialize( );
-		
-		// Initialize EntitiesManager
-		EntitiesManager::Initialize( );
-
-		// Initialize SystemsManager
-		SystemsManager::Initialize( );
-
-		// Initialize EventsManager
-		EventsManager::Initialize( );
+		// Create default World with all Managers.
+		World::Initialize( );
 
 	}
 	
@@ -107,20 +109,61 @@ namespace mecs
 	void ECSEngine::Terminate( ) noexcept
 	{
 		
-		// Terminate ComponentsManager
-		ComponentsManager::Terminate( );
-		
-		// Terminate EntitiesManager
-		EntitiesManager::Terminate( );
-
-		// Terminate SystemsManager
-		SystemsManager::Terminate( );
-
-		// Terminate EventsManager
-		EventsManager::Terminate( );
+		// Delete default World with all Managers & retired objects.
+		World::Terminate( );
 
 	}
 	
+	/**
+	 * Advance simulation of the current World by frame time with fixed steps,
+	 * & synchronize Render once (see SystemsManager::tick).
+	 * 
+	 * @thread_safety - not thread-safe, call from one (main) thread.
+	 * @param pFrameTime - elapsed (render) frame time, in seconds.
+	 * @return - number of fixed steps executed.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t ECSEngine::tick( const float pFrameTime ) noexcept
+	{ return( SystemsManager::tick( pFrameTime ) ); }
+	
+	/**
+	 * Retire object (Entity, Component), to destroy it when no reader can access it.
+	 * Object destroyed immediately, if ECSEngine is not initialized.
+	 * 
+	 * @thread_safety - thread-lock used.
+	 * @param pObject - object to retire.
+	 * @throws - no exceptions.
+	**/
+	void ECSEngine::retire( mecs_shared<void> pObject ) noexcept
+	{
+		
+		// EpochReclaimer of the current World.
+		EpochReclaimer * const reclaimer_( getReclaimer( ) );
+		
+		// Retire Object
+		if ( reclaimer_ != nullptr )
+			reclaimer_->retire( std::move( pObject ) );
+		
+	}
+	
+	/**
+	 * Destroy retired objects, which are not accessible by readers anymore.
+	 * 
+	 * @thread_safety - thread-lock used.
+	 * @throws - no exceptions.
+	**/
+	void ECSEngine::reclaim( ) noexcept
+	{
+		
+		// EpochReclaimer of the current World.
+		EpochReclaimer * const reclaimer_( getReclaimer( ) );
+		
+		// Reclaim
+		if ( reclaimer_ != nullptr )
+			reclaimer_->reclaim( );
+		
+	}
+	
 	// -----------------------------------------------------------
 	
 } // mecs
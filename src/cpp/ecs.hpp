@@ -65,6 +65,21 @@ namespace mecs
 		
 		// -----------------------------------------------------------
 		
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+		
+		/**
+		 * Returns EpochReclaimer of the current World, or null if not initialized.
+		 * 
+		 * (?) Use EpochReclaimer::Guard to read Entities & Components
+		 * via raw pointers.
+		 * 
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		static EpochReclaimer * getReclaimer( ) noexcept;
+		
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -85,6 +100,35 @@ namespace mecs
 		**/ 
 		static void Terminate( ) noexcept;
 		
+		/**
+		 * Advance simulation of the current World by frame time with fixed steps,
+		 * & synchronize Render once (see SystemsManager::tick).
+		 * 
+		 * @thread_safety - not thread-safe, call from one (main) thread.
+		 * @param pFrameTime - elapsed (render) frame time, in seconds.
+		 * @return - number of fixed steps executed.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t tick( const float pFrameTime ) noexcept;
+		
+		/**
+		 * Retire object (Entity, Component), to destroy it when no reader can access it.
+		 * Object destroyed immediately, if there is no current World.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pObject - object to retire.
+		 * @throws - no exceptions.
+		**/
+		static void retire( mecs_shared<void> pObject ) noexcept;
+		
+		/**
+		 * Destroy retired objects, which are not accessible by readers anymore.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		static void reclaim( ) noexcept;
+		
 		// -----------------------------------------------------------
 		
 	}; // mecs::ECSEngine
@@ -42,11 +42,21 @@
 #include "EntitiesManager.hpp"
 #endif // !MECS_ENTITIES_MANAGER_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
 // Include mecs::Entity
 #ifndef MECS_ENTITY_HPP
 #include "Entity.hpp"
 #endif // !MECS_ENTITY_HPP
 
+// Include mecs::ECSEngine
+#ifndef MECS_ECS_HPP
+#include "../ecs.hpp"
+#endif // !MECS_ECS_HPP
+
 // ===========================================================
 // mecs::EntitiesManager
 // ===========================================================
@@ -56,13 +66,6 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-
-	/** EntitiesManager instance. **/
-	EntitiesManager * EntitiesManager::mInstance( nullptr );
-
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -79,6 +82,11 @@ namespace mecs
 		: mEntities( )
 #endif // MULTI-THREADING
 	{
+
+		// Reset indices.
+		for ( std::size_t typeID_ = 0; typeID_ < TYPES_COUNT; typeID_++ )
+			mIndices[typeID_] = nullptr;
+
 	}
 
 	// ===========================================================
@@ -90,34 +98,65 @@ namespace mecs
 	 *
 	 * @throws - no exceptions.
 	**/
-	EntitiesManager::~EntitiesManager( ) noexcept = default;
+	EntitiesManager::~EntitiesManager( ) noexcept
+	{
+
+		// Delete indices.
+		for ( std::size_t typeID_ = 0; typeID_ < TYPES_COUNT; typeID_++ )
+		{
+			delete static_cast<EntitiesIndex*>( mIndices[typeID_] );
+			mIndices[typeID_] = nullptr;
+		}
+
+	}
 
 	// ===========================================================
 	// GETTERS & SETTERS
 	// ===========================================================
 
+	/**
+	 * Returns EntitiesManager of the current World (see World::getCurrent).
+	 *
+	 * @thread_safety - thread-local used.
+	 * @return - EntitiesManager, or null.
+	 * @throws - no exceptions.
+	**/
+	EntitiesManager * EntitiesManager::getInstance( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Return EntitiesManager
+		return( world_ != nullptr ? world_->mEntitiesManager : nullptr );
+
+	}
+
 	/**
 	 * Search any Entity of the given Type-ID.
 	 *
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Entity Type-ID.
-	 * @param pRemove - 'true' to remove Entity from cache.
+	 * @param pRemove - 'true' to remove Entity from cache, & retire it (see ECSEngine::retire).
 	 * @return - Entity, or null.
 	 * @throws - no exceptions.
 	**/
 	EntitiesManager::entity_ptr EntitiesManager::getEntity( const TypeID & pTypeID, const bool pRemove ) noexcept
 	{
 
+		// EntitiesManager of the current World.
+		EntitiesManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_lr( mInstance->mMutex );
+		mecs_ulock lock_lr( instance_->mMutex );
 #endif // MULTI-THREADING
 
 		// Search Entities vector.
-		auto vectorPos_lr = mInstance->mEntities.find( pTypeID );
+		auto vectorPos_lr = instance_->mEntities.find( pTypeID );
 
 		// Cancel
-		if ( vectorPos_lr == mInstance->mEntities.cend( ) )
+		if ( vectorPos_lr == instance_->mEntities.cend( ) )
 			return( entity_ptr( nullptr ) );
 
 		// Get Entities vector.
@@ -132,7 +171,21 @@ namespace mecs
 
 		// Remove
 		if ( pRemove )
+		{
+
+			// Remove Entity
 			entitiesVector_.pop_back( );
+			instance_->unpublishEntity( pTypeID, entity_sp.get( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Unlock
+			lock_lr.unlock( );
+#endif // MULTI-THREADING
+
+			// Retire Entity, readers may still use it (see findEntity).
+			ECSEngine::retire( entity_sp );
+
+		}
 
 		// Return Entity
 		return( entity_sp ); // Copy-construct
@@ -145,23 +198,26 @@ namespace mecs
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Entity Type-ID.
 	 * @param pID - Entity ID.
-	 * @param pRemove - 'true' to remove Entity from cache.
+	 * @param pRemove - 'true' to remove Entity from cache, & retire it (see ECSEngine::retire).
 	 * @return - Entity, or null.
 	 * @throws - no exceptions.
 	**/
 	EntitiesManager::entity_ptr EntitiesManager::getEntity( const TypeID & pTypeID, const ObjectID & pID, const bool pRemove ) noexcept
 	{
 
+		// EntitiesManager of the current World.
+		EntitiesManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_lr( mInstance->mMutex );
+		mecs_ulock lock_lr( instance_->mMutex );
 #endif // MULTI-THREADING
 
 		// Search Entities vector.
-		auto vectorPos_lr = mInstance->mEntities.find( pTypeID );
+		auto vectorPos_lr = instance_->mEntities.find( pTypeID );
 
 		// Cancel
-		if ( vectorPos_lr == mInstance->mEntities.cend( ) )
+		if ( vectorPos_lr == instance_->mEntities.cend( ) )
 			return( entity_ptr( nullptr ) );
 
 		// Entities vector.
@@ -189,8 +245,20 @@ namespace mecs
 				// Remove Entity
 				if ( pRemove )
 				{
+
+					// Remove Entity
 					std::swap( *entityPos_l, entitiesVector_lr.back( ) );
 					entitiesVector_lr.pop_back( );
+					instance_->unpublishEntity( pTypeID, entity_sp.get( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+					// Unlock
+					lock_lr.unlock( );
+#endif // MULTI-THREADING
+
+					// Retire Entity, readers may still use it (see findEntity).
+					ECSEngine::retire( entity_sp );
+
 				}
 
 				// Return
@@ -208,10 +276,146 @@ namespace mecs
 
 	}
 
+	/**
+	 * Search Entity of the given Type-ID & Object-ID, without refcounting,
+	 * with O(1) lock-free index lookup.
+	 *
+	 * (!) Pointer is valid only while caller is inside EpochReclaimer epoch
+	 * (see EpochReclaimer::Guard & destroyEntity).
+	 *
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pID - Entity ID.
+	 * @return - Entity, or null.
+	 * @throws - no exceptions.
+	**/
+	Entity * EntitiesManager::findEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept
+	{ return( getInstance( )->getPublished( pTypeID, pID ) ); }
+
+	/**
+	 * Returns Entity, published to index, or null.
+	 *
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard, or thread-lock.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pID - Entity ID.
+	 * @throws - no exceptions.
+	**/
+	Entity * EntitiesManager::getPublished( const TypeID & pTypeID, const ObjectID & pID ) const noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Index of the type.
+		const EntitiesIndex * const index_( mIndices[pTypeID].load( std::memory_order_acquire ) );
+		if ( index_ == nullptr )
+			return( nullptr );
+
+		// Page of the Entity.
+		const entity_ref_t * const page_( index_->mPages[static_cast<std::size_t>( pID ) >> INDEX_PAGE_BITS].load( std::memory_order_acquire ) );
+
+		// Entity
+		return( page_ != nullptr ? page_[pID & ( INDEX_PAGE_SIZE - 1 )].load( std::memory_order_acquire ) : nullptr );
+#else // ONE-THREAD
+		// Index of the type.
+		const EntitiesIndex * const index_( mIndices[pTypeID] );
+		if ( index_ == nullptr )
+			return( nullptr );
+
+		// Page of the Entity.
+		const entity_ref_t * const page_( index_->mPages[static_cast<std::size_t>( pID ) >> INDEX_PAGE_BITS] );
+
+		// Entity
+		return( page_ != nullptr ? page_[pID & ( INDEX_PAGE_SIZE - 1 )] : nullptr );
+#endif // MULTI-THREADING
+
+	}
+
 	// ===========================================================
 	// METHODS
 	// ===========================================================
 
+	/**
+	 * Publish Entity to index, or remove it from index.
+	 *
+	 * @thread_safety - call under thread-lock.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pID - Entity ID.
+	 * @param pEntity - Entity, or null to remove.
+	 * @throws - no exceptions.
+	**/
+	void EntitiesManager::publishEntity( const TypeID & pTypeID, const ObjectID & pID, Entity * const pEntity ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Index of the type.
+		EntitiesIndex * index_( mIndices[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Index of the type.
+		EntitiesIndex * index_( mIndices[pTypeID] );
+#endif // MULTI-THREADING
+
+		// Cancel
+		if ( index_ == nullptr && pEntity == nullptr )
+			return;
+
+		// Create index.
+		if ( index_ == nullptr )
+		{
+			index_ = new EntitiesIndex( );
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mIndices[pTypeID].store( index_, std::memory_order_release );
+#else // ONE-THREAD
+			mIndices[pTypeID] = index_;
+#endif // MULTI-THREADING
+		}
+
+		// Page of the Entity.
+		const std::size_t pageIndex_( static_cast<std::size_t>( pID ) >> INDEX_PAGE_BITS );
+		entity_ref_t * page_( index_->mPages[pageIndex_] );
+
+		// Create page.
+		if ( page_ == nullptr )
+		{
+
+			// Cancel
+			if ( pEntity == nullptr )
+				return;
+
+			page_ = new entity_ref_t[INDEX_PAGE_SIZE]( );
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			index_->mPages[pageIndex_].store( page_, std::memory_order_release );
+#else // ONE-THREAD
+			index_->mPages[pageIndex_] = page_;
+#endif // MULTI-THREADING
+
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish Entity
+		page_[pID & ( INDEX_PAGE_SIZE - 1 )].store( pEntity, std::memory_order_release );
+#else // ONE-THREAD
+		// Publish Entity
+		page_[pID & ( INDEX_PAGE_SIZE - 1 )] = pEntity;
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Remove Entity from index, if it's published.
+	 *
+	 * @thread_safety - call under thread-lock.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pEntity - Entity.
+	 * @throws - no exceptions.
+	**/
+	void EntitiesManager::unpublishEntity( const TypeID & pTypeID, Entity * const pEntity ) noexcept
+	{
+
+		// Remove, unless other Entity is published with the same ID.
+		if ( getPublished( pTypeID, pEntity->mID ) == pEntity )
+			publishEntity( pTypeID, pEntity->mID, nullptr );
+
+	}
+
 	/**
 	 * Initialize EntitiesManager.
 	 *
@@ -221,12 +425,15 @@ namespace mecs
 	void EntitiesManager::Initialize( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance != nullptr )
+		if ( world_ == nullptr || world_->mEntitiesManager != nullptr )
 			return;
 
 		// Create EntitiesManager instance.
-		mInstance = new EntitiesManager( );
+		world_->mEntitiesManager = new EntitiesManager( );
 
 	}
 
@@ -239,15 +446,18 @@ namespace mecs
 	void EntitiesManager::Terminate( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance == nullptr )
+		if ( world_ == nullptr || world_->mEntitiesManager == nullptr )
 			return;
 
 		// Delete EntitiesManager instance.
-		delete mInstance;
+		delete world_->mEntitiesManager;
 
 		// Reset pointer-value.
-		mInstance = nullptr;
+		world_->mEntitiesManager = nullptr;
 
 	}
 
@@ -262,21 +472,25 @@ namespace mecs
 	void EntitiesManager::addEntity( const TypeID & pTypeID, EntitiesManager::entity_ptr & pEntity ) noexcept
 	{
 
+		// EntitiesManager of the current World.
+		EntitiesManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_lr( mInstance->mMutex );
+		mecs_ulock lock_lr( instance_->mMutex );
 #endif // MULTI-THREADING
 
 		// Get Entities vector.
-		entities_vector & entitiesVector_lr = mInstance->mEntities[pTypeID];
+		entities_vector & entitiesVector_lr = instance_->mEntities[pTypeID];
 
 		// Add Entity
 		entitiesVector_lr.push_back( pEntity );
+		instance_->publishEntity( pTypeID, pEntity->mID, pEntity.get( ) );
 
 	}
 
 	/**
-	 * Removes all Entities of the given Type-ID.
+	 * Removes all Entities of the given Type-ID, & retires them (see ECSEngine::retire).
 	 *
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Entity Type-ID.
@@ -285,20 +499,55 @@ namespace mecs
 	void EntitiesManager::clear( const TypeID & pTypeID ) noexcept
 	{
 
+		// EntitiesManager of the current World.
+		EntitiesManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_lr( mInstance->mMutex );
+		mecs_ulock lock_lr( instance_->mMutex );
 #endif // MULTI-THREADING
 
 		// Search Entities vector.
-		auto vectorPos_lr = mInstance->mEntities.find( pTypeID );
+		auto vectorPos_lr = instance_->mEntities.find( pTypeID );
 
 		// Cancel
-		if ( vectorPos_lr == mInstance->mEntities.cend( ) )
+		if ( vectorPos_lr == instance_->mEntities.cend( ) )
 			return;
 
+		// Entities, readers may still use them (see findEntity).
+		mecs_shared<entities_vector> entities_sp( std::make_shared<entities_vector>( std::move( vectorPos_lr->second ) ) );
+
+		// Remove Entities from index.
+		for ( const entity_ptr & entity_lr : *entities_sp )
+			instance_->unpublishEntity( pTypeID, entity_lr.get( ) );
+
 		// Remove Entities vector.
-		mInstance->mEntities.erase( vectorPos_lr );
+		instance_->mEntities.erase( vectorPos_lr );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Unlock
+		lock_lr.unlock( );
+#endif // MULTI-THREADING
+
+		// Retire Entities
+		ECSEngine::retire( std::move( entities_sp ) );
+
+	}
+
+	/**
+	 * Remove Entity & retire it (see ECSEngine::retire). Entity memory & ID
+	 * are reclaimed, when all readers left their epochs.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTypeID - Entity Type-ID.
+	 * @param pID - Entity ID.
+	 * @throws - no exceptions.
+	**/
+	void EntitiesManager::destroyEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept
+	{
+
+		// Remove & retire Entity
+		getEntity( pTypeID, pID, true );
 
 	}
 
@@ -81,12 +81,89 @@ namespace mecs
 		/** Entities map. **/
 		using entities_map = mecs_map<const TypeID, entities_vector>;
 
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Type-alias for published Entity, read lock-free. **/
+		using entity_ref_t = mecs_atomic<Entity*>;
+#else // ONE-THREAD
+		/** Type-alias for published Entity. **/
+		using entity_ref_t = Entity*;
+#endif // MULTI-THREADING
+
 		// ===========================================================
-		// FIELDS
+		// CONSTANTS
+		// ===========================================================
+
+		/** Number of Entities types. **/
+		static constexpr std::size_t TYPES_COUNT = static_cast<std::size_t>( std::numeric_limits<TypeID>::max( ) ) + 1;
+
+		/** Number of bits of Entity-ID, indexing Entities in page. **/
+		static constexpr std::size_t INDEX_PAGE_BITS = 8;
+
+		/** Number of Entities in index page. **/
+		static constexpr std::size_t INDEX_PAGE_SIZE = static_cast<std::size_t>( 1 ) << INDEX_PAGE_BITS;
+
+		/** Number of index pages. **/
+		static constexpr std::size_t INDEX_PAGES_COUNT = ( static_cast<std::size_t>( std::numeric_limits<ObjectID>::max( ) ) + 1 ) / INDEX_PAGE_SIZE;
+
+		// ===========================================================
+		// mecs::EntitiesManager::EntitiesIndex
 		// ===========================================================
 
-		/** EntitiesManager instance. **/
-		static EntitiesManager * mInstance;
+		/**
+		 * EntitiesIndex - Entities of the type by Entity-ID, in pages, allocated
+		 * on demand. Written under EntitiesManager thread-lock, read lock-free
+		 * (see findEntity). Pages are deleted only with EntitiesManager.
+		**/
+		struct EntitiesIndex final
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Pages of published Entities. **/
+			mecs_atomic<entity_ref_t*> mPages[INDEX_PAGES_COUNT];
+#else // ONE-THREAD
+			/** Pages of published Entities. **/
+			entity_ref_t * mPages[INDEX_PAGES_COUNT];
+#endif // MULTI-THREADING
+
+			/**
+			 * EntitiesIndex constructor.
+			 *
+			 * @throws - no exceptions.
+			**/
+			explicit EntitiesIndex( ) noexcept
+			{
+
+				// Reset pages.
+				for ( std::size_t page_ = 0; page_ < INDEX_PAGES_COUNT; page_++ )
+					mPages[page_] = nullptr;
+
+			}
+
+			/**
+			 * EntitiesIndex destructor.
+			 *
+			 * @throws - no exceptions.
+			**/
+			~EntitiesIndex( ) noexcept
+			{
+
+				// Delete pages.
+				for ( std::size_t page_ = 0; page_ < INDEX_PAGES_COUNT; page_++ )
+					delete[] static_cast<entity_ref_t*>( mPages[page_] );
+
+			}
+
+			/* @deleted EntitiesIndex const copy constructor */
+			EntitiesIndex( const EntitiesIndex & ) = delete;
+
+			/* @deleted EntitiesIndex const copy assignment operator */
+			EntitiesIndex & operator=( const EntitiesIndex & ) = delete;
+
+		}; // EntitiesIndex
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
 
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		/** Mutex **/
@@ -96,6 +173,14 @@ namespace mecs
 		/** Entities map. **/
 		entities_map mEntities;
 
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Entities indices by Type-ID, for lock-free search (see findEntity). **/
+		mecs_atomic<EntitiesIndex*> mIndices[TYPES_COUNT];
+#else // ONE-THREAD
+		/** Entities indices by Type-ID (see findEntity). **/
+		EntitiesIndex * mIndices[TYPES_COUNT];
+#endif // MULTI-THREADING
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -107,6 +192,56 @@ namespace mecs
 		**/
 		explicit EntitiesManager( ) noexcept;
 
+		/**
+		 * Returns EntitiesManager of the current World (see World::getCurrent).
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - EntitiesManager, or null.
+		 * @throws - no exceptions.
+		**/
+		static EntitiesManager * getInstance( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Publish Entity to index, or remove it from index.
+		 *
+		 * @thread_safety - call under thread-lock.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pID - Entity ID.
+		 * @param pEntity - Entity, or null to remove.
+		 * @throws - no exceptions.
+		**/
+		void publishEntity( const TypeID & pTypeID, const ObjectID & pID, Entity * const pEntity ) noexcept;
+
+		/**
+		 * Remove Entity from index, if it's published.
+		 *
+		 * @thread_safety - call under thread-lock.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pEntity - Entity.
+		 * @throws - no exceptions.
+		**/
+		void unpublishEntity( const TypeID & pTypeID, Entity * const pEntity ) noexcept;
+
+		/**
+		 * Returns Entity, published to index, or null.
+		 *
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard, or thread-lock.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pID - Entity ID.
+		 * @throws - no exceptions.
+		**/
+		Entity * getPublished( const TypeID & pTypeID, const ObjectID & pID ) const noexcept;
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class World;
+
 		// ===========================================================
 		// DELETED
 		// ===========================================================
@@ -149,7 +284,7 @@ namespace mecs
 		 *
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Entity Type-ID.
-		 * @param pRemove - 'true' to remove Entity from cache.
+		 * @param pRemove - 'true' to remove Entity from cache, & retire it (see ECSEngine::retire).
 		 * @return - Entity, or null.
 		 * @throws - no exceptions.
 		**/
@@ -161,12 +296,27 @@ namespace mecs
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Entity Type-ID.
 		 * @param pID - Entity ID.
-		 * @param pRemove - 'true' to remove Entity from cache.
+		 * @param pRemove - 'true' to remove Entity from cache, & retire it (see ECSEngine::retire).
 		 * @return - Entity, or null.
 		 * @throws - no exceptions.
 		**/
 		static entity_ptr getEntity( const TypeID & pTypeID, const ObjectID & pID, const bool pRemove ) noexcept;
 
+		/**
+		 * Search Entity of the given Type-ID & Object-ID, without refcounting,
+		 * with O(1) lock-free index lookup.
+		 *
+		 * (!) Pointer is valid only while caller is inside EpochReclaimer epoch
+		 * (see EpochReclaimer::Guard & destroyEntity).
+		 *
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pID - Entity ID.
+		 * @return - Entity, or null.
+		 * @throws - no exceptions.
+		**/
+		static Entity * findEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept;
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -198,7 +348,7 @@ namespace mecs
 		static void addEntity( const TypeID & pTypeID, entity_ptr & pEntity ) noexcept;
 
 		/**
-		 * Removes all Entities of the given Type-ID.
+		 * Removes all Entities of the given Type-ID, & retires them (see ECSEngine::retire).
 		 *
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Entity Type-ID.
@@ -206,6 +356,17 @@ namespace mecs
 		**/
 		static void clear( const TypeID & pTypeID ) noexcept;
 
+		/**
+		 * Remove Entity & retire it (see ECSEngine::retire). Entity memory & ID
+		 * are reclaimed, when all readers left their epochs.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pTypeID - Entity Type-ID.
+		 * @param pID - Entity ID.
+		 * @throws - no exceptions.
+		**/
+		static void destroyEntity( const TypeID & pTypeID, const ObjectID & pID ) noexcept;
+
 		// -----------------------------------------------------------
 
 	}; // mecs::EntitiesManager
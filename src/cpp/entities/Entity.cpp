@@ -42,6 +42,19 @@
 #include "Entity.hpp"
 #endif // !MECS_ENTITY_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include mecs::ECSEngine
+#ifndef MECS_ECS_HPP
+#include "../ecs.hpp"
+#endif // !MECS_ECS_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
 // ===========================================================
 // mecs::Entity
 // ===========================================================
@@ -51,13 +64,6 @@ namespace mecs
 	
 	// -----------------------------------------------------------
 	
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-	
-	/** Entities IDs Storage. **/
-	IDMap<const TypeID, ObjectID> Entity::mIDStorage;
-	
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -69,13 +75,16 @@ namespace mecs
 	 * @throws - no exceptions.
 	**/
 	Entity::Entity( const TypeID & pType ) noexcept
+		: mIDStorage( &World::getCurrentEntitiesIDs( ) ),
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		: mMutex( ), mComponents( ),
+		mMutex( ), mComponents( ),
 #else // !MULTI-THREADING
-		: mComponents( ),
+		mComponents( ),
 #endif // MULTI-THREADING
+		mSnapshot( nullptr ),
+		mSnapshotOwner( ),
 		mTypeID( pType ),
-	 	mID( mIDStorage.generateID( pType ) )
+	 	mID( mIDStorage->generateID( pType ) )
 	{
 	}
 	
@@ -92,7 +101,7 @@ namespace mecs
 	{
 	
 		// Return ID
-		mIDStorage.returnID( mTypeID, mID );
+		mIDStorage->returnID( mTypeID, mID );
 	
 	}
 	
@@ -128,12 +137,83 @@ namespace mecs
 	
 	}
 	
+	/**
+	 * Search a Component with specific Type-ID, without refcounting, in
+	 * copy-on-write snapshot of Components.
+	 * 
+	 * (!) Pointer is valid only while caller is inside EpochReclaimer epoch
+	 * (see EpochReclaimer::Guard), detached Components & replaced
+	 * snapshots are retired.
+	 * 
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+	 * @param pTypeID - Component Type-ID.
+	 * @return - Component, or null.
+	 * @throws - no exceptions.
+	**/
+	Component * Entity::findComponent( const TypeID & pTypeID ) noexcept
+	{
+	
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Components snapshot.
+		const components_snapshot * const snapshot_( mSnapshot.load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Components snapshot.
+		const components_snapshot * const snapshot_( mSnapshot );
+#endif // MULTI-THREADING
+	
+		// Cancel
+		if ( snapshot_ == nullptr )
+			return( nullptr );
+	
+		// Binary search by Type-ID.
+		auto componentPosition_lr = std::lower_bound( snapshot_->cbegin( ), snapshot_->cend( ), pTypeID,
+			[]( const std::pair<TypeID, Component*> & pPair, const TypeID pKey ) { return( pPair.first < pKey ); } );
+	
+		// Cancel
+		if ( componentPosition_lr == snapshot_->cend( ) || componentPosition_lr->first != pTypeID )
+			return( nullptr );
+	
+		// Return Component
+		return( componentPosition_lr->second );
+	
+	}
+	
 	// ===========================================================
 	// METHODS
 	// ===========================================================
 	
 	/**
-	 * Attach Component.
+	 * Publish new Components snapshot, & retire previous one (see ECSEngine::retire).
+	 * 
+	 * @thread_safety - call under thread-lock.
+	 * @throws - no exceptions.
+	**/
+	void Entity::publishComponents( ) noexcept
+	{
+	
+		// Copy Components, sorted by Type-ID (map order).
+		mecs_shared<components_snapshot> snapshot_sp( std::make_shared<components_snapshot>( ) );
+		snapshot_sp->reserve( mComponents.size( ) );
+		for ( const auto & componentPair_lr : mComponents )
+			snapshot_sp->emplace_back( componentPair_lr.first, componentPair_lr.second.get( ) );
+	
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish snapshot
+		mSnapshot.store( snapshot_sp.get( ), std::memory_order_release );
+#else // ONE-THREAD
+		// Publish snapshot
+		mSnapshot = snapshot_sp.get( );
+#endif // MULTI-THREADING
+	
+		// Swap owner, & retire previous snapshot, readers may still use it.
+		mSnapshotOwner.swap( snapshot_sp );
+		if ( snapshot_sp != nullptr )
+			ECSEngine::retire( std::move( snapshot_sp ) );
+	
+	}
+	
+	/**
+	 * Attach Component. Replaced Component is retired (see ECSEngine::retire).
 	 * 
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Component Type-ID.
@@ -143,18 +223,29 @@ namespace mecs
 	void Entity::attachComponent( const TypeID & pTypeID, Entity::component_ptr & pComponent ) noexcept
 	{
 	
+		// Replaced Component.
+		component_ptr component_sp( pComponent ); // Copy-construct
+	
+		{
+	
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		// Lock
-		mecs_ulock lock_l( mMutex );
+			// Lock
+			mecs_ulock lock_l( mMutex );
 #endif // MULTI-THREADING
 	
-		// Add Component
-		mComponents[pTypeID] = pComponent;
+			// Add Component
+			std::swap( mComponents[pTypeID], component_sp );
+			publishComponents( );
+	
+		}
+	
+		// Retire replaced Component, outside of lock.
+		ECSEngine::retire( std::move( component_sp ) );
 	
 	}
 	
 	/**
-	 * Detach Component.
+	 * Detach Component. Component is retired (see ECSEngine::retire).
 	 * 
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Component Type-ID.
@@ -163,13 +254,32 @@ namespace mecs
 	void Entity::detachComponent( const TypeID & pTypeID ) noexcept
 	{
 	
+		// Detached Component.
+		component_ptr component_sp( nullptr );
+	
+		{
+	
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		// Lock
-		mecs_ulock lock_l( mMutex );
+			// Lock
+			mecs_ulock lock_l( mMutex );
 #endif // MULTI-THREADING
 	
-		// Remove Component
-		mComponents.erase( pTypeID );
+			// Search
+			auto componentPosition_lr = mComponents.find( pTypeID );
+	
+			// Cancel
+			if ( componentPosition_lr == mComponents.cend( ) )
+				return;
+	
+			// Remove Component
+			component_sp = std::move( componentPosition_lr->second );
+			mComponents.erase( componentPosition_lr );
+			publishComponents( );
+	
+		}
+	
+		// Retire Component, outside of lock.
+		ECSEngine::retire( std::move( component_sp ) );
 	
 	}
 	
@@ -88,8 +88,8 @@ namespace mecs
 		// FIELDS
 		// ===========================================================
 
-		/** Entities IDs Storage. **/
-		static IDMap<const TypeID, ObjectID> mIDStorage;
+		/** Entities IDs Storage (of World, where Entity was created). **/
+		IDMap<const TypeID, ObjectID> * const mIDStorage;
 
 		// -----------------------------------------------------------
 
@@ -106,6 +106,9 @@ namespace mecs
 		
 		/** Components map. **/
 		using components_map = mecs_map<const TypeID, component_ptr>;
+
+		/** Components snapshot: Components by Type-ID, sorted by Type-ID. **/
+		using components_snapshot = mecs_vector<std::pair<TypeID, Component*>>;
 		
 		// ===========================================================
 		// FIELDS
@@ -118,6 +121,29 @@ namespace mecs
 		
 		/** Components. **/
 		components_map mComponents;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Published Components snapshot, read lock-free (see findComponent). **/
+		mecs_atomic<const components_snapshot*> mSnapshot;
+#else // ONE-THREAD
+		/** Published Components snapshot (see findComponent). **/
+		const components_snapshot * mSnapshot;
+#endif // MULTI-THREADING
+
+		/** Components snapshot owner, previous snapshot is retired on change. **/
+		mecs_shared<components_snapshot> mSnapshotOwner;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Publish new Components snapshot, & retire previous one (see ECSEngine::retire).
+		 * 
+		 * @thread_safety - call under thread-lock.
+		 * @throws - no exceptions.
+		**/
+		void publishComponents( ) noexcept;
 		
 		// ===========================================================
 		// DELETED
@@ -181,12 +207,27 @@ namespace mecs
 		**/
 		component_ptr getComponent( const TypeID & pTypeID ) noexcept;
 		
+		/**
+		 * Search a Component with specific Type-ID, without refcounting, in
+		 * copy-on-write snapshot of Components.
+		 * 
+		 * (!) Pointer is valid only while caller is inside EpochReclaimer epoch
+		 * (see EpochReclaimer::Guard), detached Components & replaced
+		 * snapshots are retired.
+		 * 
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+		 * @param pTypeID - Component Type-ID.
+		 * @return - Component, or null.
+		 * @throws - no exceptions.
+		**/
+		Component * findComponent( const TypeID & pTypeID ) noexcept;
+		
 		// ===========================================================
 		// METHODS
 		// ===========================================================
 		
 		/**
-		 * Attach Component.
+		 * Attach Component. Replaced Component is retired (see ECSEngine::retire).
 		 * 
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Component Type-ID.
@@ -196,7 +237,7 @@ namespace mecs
 		void attachComponent( const TypeID & pTypeID, component_ptr & pComponent ) noexcept;
 		
 		/**
-		 * Detach Component.
+		 * Detach Component. Component is retired (see ECSEngine::retire).
 		 * 
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Component Type-ID.
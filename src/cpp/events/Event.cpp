@@ -42,6 +42,11 @@
 #include "Event.hpp"
 #endif // !MECS_EVENT_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
 // ===========================================================
 // mecs::Event
 // ===========================================================
@@ -51,13 +56,6 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-
-	/** Events IDs. **/
-	IDMap<const TypeID, ObjectID> Event::mEventsIDs;
-
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -67,13 +65,25 @@ namespace mecs
 	 *
 	 * @param pTypeID - Event Type-ID.
 	 * @param pRepeat - 'true' to keep sending Event until received (handled).
+	 * @param pPriority - dispatch priority (see PRIORITY_HIGH).
+	 * @param pTargetID - target Object-ID, INVALID_OBJECT_ID to never coalesce.
 	 * @throws - no exceptions.
 	**/
-	Event::Event( const TypeID & pTypeID, const bool pRepeat ) noexcept
+	Event::Event( const TypeID & pTypeID, const bool pRepeat, const std::uint8_t pPriority, const ObjectID pTargetID ) noexcept
 		: mTypeID( pTypeID ),
-		mID( mEventsIDs.generateID( pTypeID ) ),
+		mID( World::getCurrentEventsIDs( ).generateID( pTypeID ) ),
 		mHandled( false ),
-		mRepeat( pRepeat )
+		mRepeat( pRepeat ),
+		mPriority( pPriority < PRIORITIES_COUNT ? pPriority : PRIORITY_LOW ),
+		mTargetID( pTargetID ),
+		mEventsIDs( &World::getCurrentEventsIDs( ) ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mQueued( false ),
+		mQueueNext( nullptr ),
+		mQueueSelf( )
+#else // ONE-THREAD
+		mQueued( false )
+#endif // MULTI-THREADING
 	{
 	}
 
@@ -90,7 +100,45 @@ namespace mecs
 	{
 
 		// Return ID
-		mEventsIDs.returnID( mTypeID, mID );
+		mEventsIDs->returnID( mTypeID, mID );
+
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Reset Event state, before reuse (see EventPool).
+	 * Derived Events override it to reset own fields, & call Event::reset.
+	 * Pooled Event is reset to not repeated, normal priority & not queued.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void Event::reset( ) noexcept
+	{
+
+		// Reset handled flag.
+		mHandled = false;
+
+		// Reset repeat flag.
+		mRepeat = false;
+
+		// Reset priority.
+		mPriority = PRIORITY_NORMAL;
+
+		// Reset target.
+		mTargetID = INVALID_OBJECT_ID;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Queued Event is referenced by queue, so reset Event isn't queued, unless dropped from cleared queue.
+		mQueued.store( false, std::memory_order_relaxed );
+		mQueueNext = nullptr;
+#else // ONE-THREAD
+		// Queued Event is referenced by queue, so reset Event isn't queued, unless dropped from cleared queue.
+		mQueued = false;
+#endif // MULTI-THREADING
 
 	}
 
@@ -87,6 +87,18 @@ namespace mecs
 		// CONSTANTS
 		// ===========================================================
 
+		/** Priority of latency-critical Events (input, network). **/
+		static constexpr const std::uint8_t PRIORITY_HIGH = 0;
+
+		/** Default priority. **/
+		static constexpr const std::uint8_t PRIORITY_NORMAL = 1;
+
+		/** Priority of cosmetic Events. **/
+		static constexpr const std::uint8_t PRIORITY_LOW = 2;
+
+		/** Number of priorities. **/
+		static constexpr const std::uint8_t PRIORITIES_COUNT = 3;
+
 		/** Type-ID. **/
 		const TypeID mTypeID;
 
@@ -108,6 +120,12 @@ namespace mecs
 		/** Repeat until handled flag. **/
 		bool mRepeat;
 
+		/** Dispatch priority (see PRIORITY_HIGH), lower value is dispatched first. **/
+		std::uint8_t mPriority;
+
+		/** Target Object-ID (Entity, Component), key to coalesce queued Events (see EventsManager::setCoalescing). **/
+		ObjectID mTargetID;
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -117,9 +135,11 @@ namespace mecs
 		 *
 		 * @param pTypeID - Event Type-ID.
 		 * @param pRepeat - 'true' to keep sending Event until received (handled).
+		 * @param pPriority - dispatch priority (see PRIORITY_HIGH).
+		 * @param pTargetID - target Object-ID, INVALID_OBJECT_ID to never coalesce.
 		 * @throws - no exceptions.
 		**/
-		explicit Event( const TypeID & pTypeID, const bool pRepeat ) noexcept;
+		explicit Event( const TypeID & pTypeID, const bool pRepeat, const std::uint8_t pPriority = PRIORITY_NORMAL, const ObjectID pTargetID = INVALID_OBJECT_ID ) noexcept;
 
 		// ===========================================================
 		// DESTRUCTOR
@@ -132,6 +152,20 @@ namespace mecs
 		**/
 		virtual ~Event( ) noexcept;
 
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Reset Event state, before reuse (see EventPool).
+		 * Derived Events override it to reset own fields, & call Event::reset.
+		 * Pooled Event is reset to not repeated, normal priority & not queued.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		virtual void reset( ) noexcept;
+
 		// -----------------------------------------------------------
 
 	private:
@@ -142,8 +176,30 @@ namespace mecs
 		// FIELDS
 		// ===========================================================
 
-		/** Events IDs. **/
-		static IDMap<const TypeID, ObjectID> mEventsIDs;
+		/** Events IDs (of World, where Event was created). **/
+		IDMap<const TypeID, ObjectID> * const mEventsIDs;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Queued flag, to ignore sending queued Event again. **/
+		mecs_abool mQueued;
+#else // ONE-THREAD
+		/** Queued flag, to ignore sending queued Event again. **/
+		bool mQueued;
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Next Event in EventsManager incoming queue (intrusive link). **/
+		Event * mQueueNext;
+
+		/** Reference, owned by EventsManager incoming queue while Event is queued. **/
+		mecs_shared<Event> mQueueSelf;
+#endif // MULTI-THREADING
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class EventsManager;
 
 		// ===========================================================
 		// DELETED
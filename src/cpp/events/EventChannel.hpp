@@ -0,0 +1,428 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef MECS_EVENT_CHANNEL_HPP
+#define MECS_EVENT_CHANNEL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// Include C++ type_traits
+#include <type_traits>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::IEventChannel
+	// ===========================================================
+
+	/**
+	 * IEventChannel - type-erased EventChannel, dispatched by EventsManager.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class IEventChannel
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Events Type-ID. **/
+		const TypeID mTypeID;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * IEventChannel destructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		virtual ~IEventChannel( ) noexcept = default;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of queued (not dispatched yet) Events.
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @throws - no exceptions.
+		**/
+		virtual std::size_t getPendingCount( ) const noexcept = 0;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Pass queued Events to listeners.
+		 *
+		 * @thread_safety - call from one (main) thread, Events can be sent meanwhile.
+		 * @return - number of dispatched Events.
+		 * @throws - no exceptions.
+		**/
+		virtual std::size_t dispatch( ) noexcept = 0;
+
+		/**
+		 * Remove queued Events.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		virtual void clear( ) noexcept = 0;
+
+		// -----------------------------------------------------------
+
+	protected:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * IEventChannel constructor.
+		 *
+		 * @param pTypeID - Events Type-ID.
+		 * @throws - no exceptions.
+		**/
+		explicit IEventChannel( const TypeID & pTypeID ) noexcept
+			: mTypeID( pTypeID )
+		{
+		}
+
+		// -----------------------------------------------------------
+
+	}; // mecs::IEventChannel
+
+	// ===========================================================
+	// mecs::EventChannel
+	// ===========================================================
+
+	/**
+	 * EventChannel - stores Events of one type by value, in contiguous memory,
+	 * without heap objects, IDs, or virtual calls per Event.
+	 * 
+	 * (?) Two buffers are used in turn: Events are appended (copied) to the
+	 * write buffer, dispatch swaps buffers & walks the read buffer without lock,
+	 * while new Events are sent. Buffers keep their memory, so warmed-up
+	 * channel doesn't allocate.
+	 * 
+	 * (?) Listeners receive all dispatched Events with one call.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	template <typename T>
+	class EventChannel final : public IEventChannel
+	{
+
+		static_assert( std::is_trivially_copyable<T>::value, "mecs::EventChannel - Event must be trivially copyable." );
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for listener: receives contiguous Events. **/
+		using listener_t = std::function<void( const T * const pEvents, const std::size_t pCount )>;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * EventChannel constructor.
+		 *
+		 * @param pTypeID - Events Type-ID.
+		 * @throws - no exceptions.
+		**/
+		explicit EventChannel( const TypeID & pTypeID ) noexcept
+			: IEventChannel( pTypeID ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mMutex( ),
+#endif // MULTI-THREADING
+			mWrite( ),
+			mRead( ),
+			mPending( 0 ),
+			mListeners( )
+		{
+		}
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of queued (not dispatched yet) Events.
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @throws - no exceptions.
+		**/
+		virtual std::size_t getPendingCount( ) const noexcept final
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			return( mPending.load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+			return( mPending );
+#endif // MULTI-THREADING
+		}
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Queue Event (copy).
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		void send( const T & pEvent ) noexcept
+		{ send( &pEvent, 1 ); }
+
+		/**
+		 * Queue Events (copy) with one lock.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pEvents - Events.
+		 * @param pCount - number of Events.
+		 * @throws - no exceptions.
+		**/
+		void send( const T * const pEvents, const std::size_t pCount ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Lock
+			mecs_ulock lock_( mMutex );
+#endif // MULTI-THREADING
+
+			// Copy Events
+			mWrite.insert( mWrite.end( ), pEvents, pEvents + pCount );
+
+			// Count pending Events.
+			mPending += pCount;
+
+		}
+
+		/**
+		 * Add listener.
+		 *
+		 * @thread_safety - not thread-safe, call from the dispatching thread.
+		 * @param pListener - listener.
+		 * @return - listener index, to remove it (see removeListener).
+		 * @throws - no exceptions.
+		**/
+		std::size_t addListener( listener_t pListener ) noexcept
+		{
+
+			// Reuse free slot.
+			for ( std::size_t index_ = 0; index_ < mListeners.size( ); index_++ )
+			{
+				if ( !mListeners[index_] )
+				{
+					mListeners[index_] = std::move( pListener );
+					return( index_ );
+				}
+			}
+
+			// Add listener
+			mListeners.push_back( std::move( pListener ) );
+			return( mListeners.size( ) - 1 );
+
+		}
+
+		/**
+		 * Remove listener.
+		 *
+		 * @thread_safety - not thread-safe, call from the dispatching thread.
+		 * @param pIndex - listener index (see addListener).
+		 * @throws - no exceptions.
+		**/
+		void removeListener( const std::size_t pIndex ) noexcept
+		{
+			if ( pIndex < mListeners.size( ) )
+				mListeners[pIndex] = nullptr;
+		}
+
+		/**
+		 * Pass queued Events to listeners.
+		 *
+		 * @thread_safety - call from one (main) thread, Events can be sent meanwhile.
+		 * @return - number of dispatched Events.
+		 * @throws - no exceptions.
+		**/
+		virtual std::size_t dispatch( ) noexcept final
+		{
+
+			// Swap buffers.
+			{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+				mecs_ulock lock_( mMutex );
+#endif // MULTI-THREADING
+				mRead.swap( mWrite );
+				mPending -= mRead.size( );
+			}
+
+			// Pass Events to listeners.
+			if ( !mRead.empty( ) )
+			{
+				for ( const listener_t & listener_lr : mListeners )
+				{
+					if ( listener_lr )
+						listener_lr( mRead.data( ), mRead.size( ) );
+				}
+			}
+
+			// Clear, keeping allocated memory.
+			const std::size_t count_( mRead.size( ) );
+			mRead.clear( );
+
+			// Return number of Events.
+			return( count_ );
+
+		}
+
+		/**
+		 * Remove queued Events.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		virtual void clear( ) noexcept final
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Lock
+			mecs_ulock lock_( mMutex );
+#endif // MULTI-THREADING
+
+			// Remove Events
+			mPending -= mWrite.size( );
+			mWrite.clear( );
+
+		}
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Write buffer Mutex. **/
+		mecs_mutex mMutex;
+#endif // MULTI-THREADING
+
+		/** Write buffer: queued Events. **/
+		mecs_vector<T> mWrite;
+
+		/** Read buffer: dispatched Events. **/
+		mecs_vector<T> mRead;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Number of queued Events. **/
+		mecs_atomic<std::size_t> mPending;
+#else // ONE-THREAD
+		/** Number of queued Events. **/
+		std::size_t mPending;
+#endif // MULTI-THREADING
+
+		/** Listeners. Empty slots are removed listeners. **/
+		mecs_vector<listener_t> mListeners;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		EventChannel( const EventChannel & ) = delete;
+		EventChannel & operator=( const EventChannel & ) = delete;
+		EventChannel( EventChannel && ) = delete;
+		EventChannel & operator=( EventChannel && ) = delete;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::EventChannel
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_EVENT_CHANNEL_DECL
+#define MECS_EVENT_CHANNEL_DECL
+template <typename T>
+using mecs_EventChannel = mecs::EventChannel<T>;
+#endif // !MECS_EVENT_CHANNEL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_EVENT_CHANNEL_HPP
@@ -0,0 +1,708 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_EVENT_POOL_HPP
+#define MECS_EVENT_POOL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// Include mecs::Event
+#ifndef MECS_EVENT_HPP
+#include "Event.hpp"
+#endif // !MECS_EVENT_HPP
+
+// Include C++ cstddef
+#include <cstddef>
+
+// Include C++ new
+#include <new>
+
+// Include C++ type_traits
+#include <type_traits>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::IEventPool
+	// ===========================================================
+
+	/**
+	 * IEventPool - type-erased EventPool, used by EventsManager.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class IEventPool
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Events Type-ID. **/
+		const TypeID mTypeID;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * IEventPool destructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		virtual ~IEventPool( ) noexcept = default;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of Events slots (free & used).
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @throws - no exceptions.
+		**/
+		virtual std::uint32_t getCapacity( ) const noexcept = 0;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns free Event.
+		 *
+		 * @thread_safety - lock-free, thread-lock used to grow.
+		 * @return - Event.
+		 * @throws - no exceptions.
+		**/
+		virtual mecs_shared<Event> acquireEvent( ) noexcept = 0;
+
+		// -----------------------------------------------------------
+
+	protected:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * IEventPool constructor.
+		 *
+		 * @param pTypeID - Events Type-ID.
+		 * @throws - no exceptions.
+		**/
+		explicit IEventPool( const TypeID & pTypeID ) noexcept
+			: mTypeID( pTypeID )
+		{
+		}
+
+		// -----------------------------------------------------------
+
+	}; // mecs::IEventPool
+
+	// ===========================================================
+	// mecs::EventPool
+	// ===========================================================
+
+	/**
+	 * EventPool - recycles Events of one type. Events are constructed in place,
+	 * in slabs of contiguous slots, once per slot, & reset (see Event::reset)
+	 * when the last reference is released.
+	 * 
+	 * (?) Slot also stores shared-pointer control block, so warmed-up pool
+	 * doesn't allocate. Free slots are kept in lock-free stack (index & tag).
+	 * 
+	 * (!) Event type must be default-constructible. All Events must be
+	 * released before EventPool destroyed (see EventsManager).
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	template <typename T>
+	class EventPool final : public IEventPool
+	{
+
+		static_assert( std::is_base_of<Event, T>::value, "mecs::EventPool - Event type must be derived from mecs::Event." );
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Number of slots in the first slab, next slabs are doubled. **/
+		static constexpr const std::uint32_t SLAB_SIZE = 32;
+
+		/** Max number of slabs. **/
+		static constexpr const std::uint32_t SLABS_COUNT = 24;
+
+		/** Size of control block storage. **/
+		static constexpr const std::size_t BLOCK_SIZE = 64;
+
+		/** Mask of slot index (+1) in free stack head, 0 if empty. **/
+		static constexpr const std::uint64_t INDEX_MASK = 0xFFFFFFFFull;
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// mecs::EventPool::Slot
+		// ===========================================================
+
+		/**
+		 * Slot - Event & control block storage.
+		**/
+		struct Slot final
+		{
+
+			/** Event storage. **/
+			alignas( T ) unsigned char mEvent[sizeof( T )];
+
+			/** Control block storage. **/
+			alignas( std::max_align_t ) unsigned char mBlock[BLOCK_SIZE];
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Next free slot index (+1), 0 if last. **/
+			mecs_atomic<std::uint32_t> mNext;
+#else // ONE-THREAD
+			/** Next free slot index (+1), 0 if last. **/
+			std::uint32_t mNext;
+#endif // MULTI-THREADING
+
+			/** Slot index. **/
+			std::uint32_t mIndex;
+
+			/** Event constructed flag. **/
+			bool mConstructed;
+
+		}; // mecs::EventPool::Slot
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// mecs::EventPool::Reset
+		// ===========================================================
+
+		/**
+		 * Reset - shared-pointer deleter, resets Event instead of destroying.
+		**/
+		struct Reset final
+		{
+
+			/**
+			 * Reset Event.
+			 *
+			 * @param pEvent - Event.
+			 * @throws - no exceptions.
+			**/
+			void operator()( T * const pEvent ) const noexcept
+			{ pEvent->reset( ); }
+
+		}; // mecs::EventPool::Reset
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// mecs::EventPool::BlockAllocator
+		// ===========================================================
+
+		/**
+		 * BlockAllocator - places control block in the slot, & returns slot
+		 * to EventPool, when control block released.
+		**/
+		template <typename U>
+		struct BlockAllocator final
+		{
+
+			/** Type-alias for allocated type. **/
+			using value_type = U;
+
+			/** Rebind to other type. **/
+			template <typename V>
+			struct rebind
+			{ using other = BlockAllocator<V>; };
+
+			/** Slot. **/
+			Slot * mSlot;
+
+			/** EventPool. **/
+			EventPool * mPool;
+
+			/**
+			 * BlockAllocator constructor.
+			 *
+			 * @param pSlot - Slot.
+			 * @param pPool - EventPool.
+			 * @throws - no exceptions.
+			**/
+			BlockAllocator( Slot * const pSlot, EventPool * const pPool ) noexcept
+				: mSlot( pSlot ),
+				mPool( pPool )
+			{
+			}
+
+			/**
+			 * BlockAllocator rebind constructor.
+			 *
+			 * @param pOther - BlockAllocator of other type.
+			 * @throws - no exceptions.
+			**/
+			template <typename V>
+			BlockAllocator( const BlockAllocator<V> & pOther ) noexcept
+				: mSlot( pOther.mSlot ),
+				mPool( pOther.mPool )
+			{
+			}
+
+			/**
+			 * Returns control block storage of the slot.
+			 *
+			 * @param pCount - number of objects, 1.
+			 * @throws - no exceptions.
+			**/
+			U * allocate( const std::size_t pCount ) noexcept
+			{
+				static_assert( sizeof( U ) <= BLOCK_SIZE && alignof( U ) <= alignof( std::max_align_t ), "mecs::EventPool - control block doesn't fit." );
+				( void )pCount;
+				return( reinterpret_cast<U*>( mSlot->mBlock ) );
+			}
+
+			/**
+			 * Returns slot to EventPool.
+			 *
+			 * @param pBlock - control block.
+			 * @param pCount - number of objects, 1.
+			 * @throws - no exceptions.
+			**/
+			void deallocate( U * const pBlock, const std::size_t pCount ) noexcept
+			{
+				( void )pBlock;
+				( void )pCount;
+				mPool->release( mSlot );
+			}
+
+			/** Compare BlockAllocators. **/
+			template <typename V>
+			bool operator==( const BlockAllocator<V> & pOther ) const noexcept
+			{ return( mSlot == pOther.mSlot ); }
+
+			/** Compare BlockAllocators. **/
+			template <typename V>
+			bool operator!=( const BlockAllocator<V> & pOther ) const noexcept
+			{ return( mSlot != pOther.mSlot ); }
+
+		}; // mecs::EventPool::BlockAllocator
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Mutex, used to add slabs. **/
+		mecs_mutex mMutex;
+
+		/** Free slots stack head: tag (high 32 bits) & slot index + 1. **/
+		mecs_atomic<std::uint64_t> mFree;
+
+		/** Number of slabs. **/
+		mecs_atomic<std::uint32_t> mSlabsCount;
+#else // ONE-THREAD
+		/** Free slots stack head: slot index + 1. **/
+		std::uint64_t mFree;
+
+		/** Number of slabs. **/
+		std::uint32_t mSlabsCount;
+#endif // MULTI-THREADING
+
+		/** Slabs. Never moved, so slots can be accessed without lock. **/
+		Slot * mSlabs[SLABS_COUNT];
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of slots in the slabs.
+		 *
+		 * @param pSlabs - number of slabs.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getSlotsCount( const std::uint32_t pSlabs ) noexcept
+		{ return( SLAB_SIZE * ( ( 1u << pSlabs ) - 1 ) ); }
+
+		/**
+		 * Returns slot by index.
+		 *
+		 * @param pIndex - slot index.
+		 * @throws - no exceptions.
+		**/
+		Slot * getSlot( const std::uint32_t pIndex ) const noexcept
+		{
+
+			// Slab: highest bit of (index / SLAB_SIZE + 1).
+			const std::uint32_t position_( pIndex / SLAB_SIZE + 1 );
+			std::uint32_t slab_( 0 );
+			while ( ( position_ >> ( slab_ + 1 ) ) != 0 )
+				slab_++;
+
+			// Return Slot
+			return( &mSlabs[slab_][pIndex - getSlotsCount( slab_ )] );
+
+		}
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Take free slot.
+		 *
+		 * @thread_safety - lock-free.
+		 * @return - slot, or null.
+		 * @throws - no exceptions.
+		**/
+		Slot * pop( ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Free stack head.
+			std::uint64_t head_( mFree.load( std::memory_order_acquire ) );
+
+			// Take first slot, tag prevents ABA.
+			while ( ( head_ & INDEX_MASK ) != 0 )
+			{
+
+				Slot * const slot_( getSlot( static_cast<std::uint32_t>( head_ & INDEX_MASK ) - 1 ) );
+				const std::uint64_t next_( ( ( ( head_ >> 32 ) + 1 ) << 32 ) | slot_->mNext.load( std::memory_order_relaxed ) );
+
+				if ( mFree.compare_exchange_weak( head_, next_, std::memory_order_acquire, std::memory_order_acquire ) )
+					return( slot_ );
+
+			}
+
+			return( nullptr );
+#else // ONE-THREAD
+			// Cancel
+			if ( mFree == 0 )
+				return( nullptr );
+
+			// Take first slot.
+			Slot * const slot_( getSlot( static_cast<std::uint32_t>( mFree ) - 1 ) );
+			mFree = slot_->mNext;
+
+			return( slot_ );
+#endif // MULTI-THREADING
+
+		}
+
+		/**
+		 * Return slot to free stack.
+		 *
+		 * @thread_safety - lock-free.
+		 * @param pSlot - slot.
+		 * @throws - no exceptions.
+		**/
+		void release( Slot * const pSlot ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Free stack head.
+			std::uint64_t head_( mFree.load( std::memory_order_relaxed ) );
+			std::uint64_t next_( 0 );
+
+			// Push slot.
+			do
+			{
+				pSlot->mNext.store( static_cast<std::uint32_t>( head_ & INDEX_MASK ), std::memory_order_relaxed );
+				next_ = ( ( ( head_ >> 32 ) + 1 ) << 32 ) | ( pSlot->mIndex + 1 );
+			}
+			while ( !mFree.compare_exchange_weak( head_, next_, std::memory_order_release, std::memory_order_relaxed ) );
+#else // ONE-THREAD
+			// Push slot.
+			pSlot->mNext = static_cast<std::uint32_t>( mFree );
+			mFree = pSlot->mIndex + 1;
+#endif // MULTI-THREADING
+
+		}
+
+		/**
+		 * Add slab, & take one of its slots.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @return - slot, or null if max number of slabs reached.
+		 * @throws - no exceptions.
+		**/
+		Slot * grow( ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Lock
+			mecs_ulock lock_( mMutex );
+
+			// Slot, released while waiting.
+			Slot * const freeSlot_( pop( ) );
+			if ( freeSlot_ != nullptr )
+				return( freeSlot_ );
+#endif // MULTI-THREADING
+
+			// Slab index.
+			const std::uint32_t slab_( mSlabsCount );
+
+			// Cancel
+			if ( slab_ >= SLABS_COUNT )
+				return( nullptr );
+
+			// Add slab
+			const std::uint32_t first_( getSlotsCount( slab_ ) );
+			const std::uint32_t size_( SLAB_SIZE << slab_ );
+			Slot * const slots_( new Slot[size_] );
+			for ( std::uint32_t index_ = 0; index_ < size_; index_++ )
+			{
+				slots_[index_].mNext = 0;
+				slots_[index_].mIndex = first_ + index_;
+				slots_[index_].mConstructed = false;
+			}
+			mSlabs[slab_] = slots_;
+			mSlabsCount = slab_ + 1;
+
+			// Free all slots, except the first one.
+			for ( std::uint32_t index_ = size_ - 1; index_ > 0; index_-- )
+				release( &slots_[index_] );
+
+			return( &slots_[0] );
+
+		}
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * EventPool constructor.
+		 *
+		 * @param pTypeID - Events Type-ID.
+		 * @throws - no exceptions.
+		**/
+		explicit EventPool( const TypeID & pTypeID ) noexcept
+			: IEventPool( pTypeID ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mMutex( ),
+#endif // MULTI-THREADING
+			mFree( 0 ),
+			mSlabsCount( 0 ),
+			mSlabs( )
+		{
+		}
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * EventPool destructor. Destroys Events & slabs.
+		 *
+		 * @throws - no exceptions.
+		**/
+		virtual ~EventPool( ) noexcept
+		{
+
+			// Slabs
+			const std::uint32_t slabsCount_( mSlabsCount );
+			for ( std::uint32_t slab_ = 0; slab_ < slabsCount_; slab_++ )
+			{
+
+				// Destroy Events
+				const std::uint32_t size_( SLAB_SIZE << slab_ );
+				for ( std::uint32_t index_ = 0; index_ < size_; index_++ )
+				{
+					if ( mSlabs[slab_][index_].mConstructed )
+						reinterpret_cast<T*>( mSlabs[slab_][index_].mEvent )->~T( );
+				}
+
+				// Delete slab
+				delete[] mSlabs[slab_];
+				mSlabs[slab_] = nullptr;
+
+			}
+
+		}
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of Events slots (free & used).
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @throws - no exceptions.
+		**/
+		virtual std::uint32_t getCapacity( ) const noexcept final
+		{ return( getSlotsCount( mSlabsCount ) ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns free Event. Event is constructed (default) on the first use
+		 * of the slot, & returned to EventPool when the last reference released.
+		 *
+		 * @thread_safety - lock-free, thread-lock used to grow.
+		 * @return - Event, or null if max capacity reached.
+		 * @throws - no exceptions.
+		**/
+		mecs_shared<T> acquire( ) noexcept
+		{
+
+			// Free slot
+			Slot * slot_( pop( ) );
+
+			// Add slab
+			if ( slot_ == nullptr )
+				slot_ = grow( );
+
+			// Cancel
+			if ( slot_ == nullptr )
+				return( mecs_shared<T>( nullptr ) );
+
+			// Construct Event
+			if ( !slot_->mConstructed )
+			{
+				new( slot_->mEvent ) T( );
+				slot_->mConstructed = true;
+			}
+
+			// Return Event, control block is placed in the slot.
+			return( mecs_shared<T>( reinterpret_cast<T*>( slot_->mEvent ), Reset( ), BlockAllocator<T>( slot_, this ) ) );
+
+		}
+
+		/**
+		 * Returns free Event.
+		 *
+		 * @thread_safety - lock-free, thread-lock used to grow.
+		 * @return - Event.
+		 * @throws - no exceptions.
+		**/
+		virtual mecs_shared<Event> acquireEvent( ) noexcept final
+		{ return( acquire( ) ); }
+
+		/**
+		 * Add slabs, until EventPool has at least the number of slots.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pCount - number of slots.
+		 * @throws - no exceptions.
+		**/
+		void reserve( const std::uint32_t pCount ) noexcept
+		{
+			while ( getCapacity( ) < pCount && mSlabsCount < SLABS_COUNT )
+			{
+				Slot * const slot_( grow( ) );
+				if ( slot_ != nullptr )
+					release( slot_ );
+			}
+		}
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		EventPool( const EventPool & ) = delete;
+		EventPool & operator=( const EventPool & ) = delete;
+		EventPool( EventPool && ) = delete;
+		EventPool & operator=( EventPool && ) = delete;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::EventPool
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_EVENT_POOL_DECL
+#define MECS_EVENT_POOL_DECL
+template <typename T>
+using mecs_EventPool = mecs::EventPool<T>;
+#endif // !MECS_EVENT_POOL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_EVENT_POOL_HPP
@@ -42,6 +42,16 @@
 #include "EventsManager.hpp"
 #endif // !MECS_EVENTS_MANAGER_HPP
 
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include mecs::ECSEngine
+#ifndef MECS_HPP
+#include "../ecs.hpp"
+#endif // !MECS_HPP
+
 // Include mecs::Event
 #ifndef MECS_EVENT_HPP
 #include "Event.hpp"
@@ -52,6 +62,22 @@
 #include "IEventListener.hxx"
 #endif // !MECS_I_EVENT_LISTENER_HPP
 
+// Include mecs::SystemsManager
+#ifndef MECS_SYSTEMS_MANAGER_HPP
+#include "../systems/SystemsManager.hpp"
+#endif // !MECS_SYSTEMS_MANAGER_HPP
+
+// Include mecs::ThreadPool
+#ifndef MECS_THREAD_POOL_HPP
+#include "../utils/ThreadPool.hpp"
+#endif // !MECS_THREAD_POOL_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ thread
+#include <thread>
+
 // ===========================================================
 // mecs::EventsManager
 // ===========================================================
@@ -61,13 +87,6 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-
-	/** EventsManager instance. **/
-	EventsManager * EventsManager::mInstance( nullptr );
-
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -86,9 +105,40 @@ namespace mecs
 #else // ONE-THREAD
 		: mEvents( ),
 #endif // MULTI-THREADING
-		mEventsQueue( ),
+		mEventsQueues( ),
+		mCoalesced( ),
+		mDoubleBuffered( false ),
+		mFrameQueues( ),
+		mDispatched( 0 ),
+		mCascadeCount( 0 ),
+		mRepeated( ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mTimersMutex( ),
+#endif // MULTI-THREADING
+		mTimers( ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mParallel( false ),
+#endif // MULTI-THREADING
+		mBatches( ),
+		mBatchTypes( ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mIncoming( nullptr ),
+#endif // MULTI-THREADING
 		mEventListeners( )
 	{
+
+		// Reset pending Events counters, IEventListeners snapshots & EventChannels.
+		for ( std::size_t typeID_ = 0; typeID_ < TYPES_COUNT; typeID_++ )
+		{
+			mPending[typeID_] = 0;
+			mListenersSnapshots[typeID_] = nullptr;
+			mTargeted[typeID_] = nullptr;
+			mBatched[typeID_] = false;
+			mCoalescing[typeID_] = false;
+			mChannels[typeID_] = nullptr;
+			mPools[typeID_] = nullptr;
+		}
+
 	}
 
 	// ===========================================================
@@ -100,115 +150,1167 @@ namespace mecs
 	 *
 	 * @throws - no exceptions.
 	**/
-	EventsManager::~EventsManager( ) noexcept = default;
+	EventsManager::~EventsManager( ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Release incoming Events.
+		drainIncoming( );
+#endif // MULTI-THREADING
+
+		// Release delayed, queued & cached Events, before EventPools.
+		mTimers.clear( );
+		mRepeated.clear( );
+		mCoalesced.clear( );
+		for ( events_queue_t & queue_lr : mEventsQueues )
+			queue_lr.clear( );
+		for ( events_queue_t & queue_lr : mFrameQueues )
+			queue_lr.clear( );
+		mEvents.clear( );
+
+		// Delete targeted IEventListeners, EventChannels & EventPools
+		for ( std::size_t typeID_ = 0; typeID_ < TYPES_COUNT; typeID_++ )
+		{
+			delete mTargeted[typeID_];
+			mTargeted[typeID_] = nullptr;
+			delete mChannels[typeID_];
+			mChannels[typeID_] = nullptr;
+			delete mPools[typeID_];
+			mPools[typeID_] = nullptr;
+		}
+
+	}
 
 	// ===========================================================
 	// GETTERS & SETTERS
 	// ===========================================================
 
 	/**
-	 * Returns next IEventListener in queue, or null.
-	 *
-	 * (?) Used instead of iteration while locked, to avoid self-lock
-	 * & reduce wait-time.
+	 * Returns EventsManager of the current World (see World::getCurrent).
+	 *
+	 * @thread_safety - thread-local used.
+	 * @return - EventsManager, or null.
+	 * @throws - no exceptions.
+	**/
+	EventsManager * EventsManager::getInstance( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Return EventsManager
+		return( world_ != nullptr ? world_->mEventsManager : nullptr );
+
+	}
+
+	/**
+	 * Returns next Event in queue, or null.
+	 * Event of the highest priority is returned first.
+	 * In double-buffered mode, Event is taken from frame queues.
+	 *
+	 * (?) Used instead of iteration while locked, to avoid self-lock
+	 * & reduce wait-time.
+	 *
+	 * @thread_safety - thread-lock used, lock-free in double-buffered mode.
+	 * @return - Event, or null.
+	 * @throws - no exceptions.
+	**/
+	EventsManager::event_ptr_t EventsManager::getNextEvent( ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Double-buffered mode: frame queues are accessed only by the dispatching thread.
+		const bool doubleBuffered_( instance_->mDoubleBuffered.load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Double-buffered mode: frame queues are accessed only by the dispatching thread.
+		const bool doubleBuffered_( instance_->mDoubleBuffered );
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock Events Queues.
+		mecs_ulock lock_( instance_->mEventsQueueMutex, std::defer_lock );
+		if ( !doubleBuffered_ )
+		{
+
+			// Lock
+			lock_.lock( );
+
+			// Take incoming Events, so latency-critical ones don't wait behind queued.
+			if ( instance_->mIncoming.load( std::memory_order_relaxed ) != nullptr )
+				instance_->drainIncoming( );
+
+		}
+#endif // MULTI-THREADING
+
+		// Queues of the current frame.
+		events_queue_t * const queues_( doubleBuffered_ ? instance_->mFrameQueues : instance_->mEventsQueues );
+
+		// Search queue of the highest priority with Events.
+		for ( std::size_t priority_ = 0; priority_ < Event::PRIORITIES_COUNT; priority_++ )
+		{
+
+			// Events Queue.
+			events_queue_t & queue_lr = queues_[priority_];
+
+			// Skip empty queue.
+			if ( queue_lr.empty( ) )
+				continue;
+
+			// Remove Event from coalescing index (frame queues are not indexed).
+			if ( !doubleBuffered_ && !instance_->mCoalesced.empty( ) )
+			{
+				const events_index_t::iterator index_( instance_->mCoalesced.find( getCoalescingKey( *queue_lr.front( ) ) ) );
+				if ( index_ != instance_->mCoalesced.end( ) && index_->second == &queue_lr.front( ) )
+					instance_->mCoalesced.erase( index_ );
+			}
+
+			// Get Event
+			event_ptr_t event_sp( std::move( queue_lr.front( ) ) );
+
+			// Remove Event from queue.
+			queue_lr.pop_front( );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Count pending Events.
+			instance_->mPending[event_sp->mTypeID].fetch_sub( 1, std::memory_order_relaxed );
+
+			// Event can be sent again.
+			event_sp->mQueued.store( false, std::memory_order_relaxed );
+#else // ONE-THREAD
+			// Count pending Events.
+			instance_->mPending[event_sp->mTypeID]--;
+
+			// Event can be sent again.
+			event_sp->mQueued = false;
+#endif // MULTI-THREADING
+
+			// Count dispatched Events.
+			instance_->mDispatched++;
+
+			// Return Event
+			return( event_sp );
+
+		}
+
+		// No Events.
+		return( event_ptr_t( nullptr ) );
+
+	}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	/**
+	 * Move incoming Events to Events Queues, in sending order.
+	 * Events of coalescing types replace queued ones (see coalesceEvent).
+	 *
+	 * @thread_safety - call under Events Queue thread-lock.
+	 * @return - 'true' if any Event moved.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::drainIncoming( ) noexcept
+	{
+
+		// Take all incoming Events with one exchange.
+		Event * event_( mIncoming.exchange( nullptr, std::memory_order_acquire ) );
+
+		// Cancel
+		if ( event_ == nullptr )
+			return( false );
+
+		// Reverse list: newest first -> oldest first.
+		Event * oldest_( nullptr );
+		while ( event_ != nullptr )
+		{
+			Event * const next_( event_->mQueueNext );
+			event_->mQueueNext = oldest_;
+			oldest_ = event_;
+			event_ = next_;
+		}
+
+		// Move to Events Queues by priority, with queue references.
+		while ( oldest_ != nullptr )
+		{
+			Event * const next_( oldest_->mQueueNext );
+			oldest_->mQueueNext = nullptr;
+			event_ptr_t event_sp( std::move( oldest_->mQueueSelf ) );
+
+			// Coalescing Event: replace queued Event, sender counted it as pending.
+			if ( isCoalescing( *event_sp ) )
+			{
+				if ( coalesceEvent( event_sp ) )
+					mPending[event_sp->mTypeID].fetch_sub( 1, std::memory_order_relaxed );
+			}
+			else
+				mEventsQueues[event_sp->mPriority].push_back( std::move( event_sp ) );
+
+			oldest_ = next_;
+		}
+
+		return( true );
+
+	}
+#endif // MULTI-THREADING
+
+	/**
+	 * Returns number of queued Events, including incoming ones.
+	 *
+	 * @thread_safety - call under Events Queue thread-lock.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t EventsManager::countQueued( ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Take incoming Events.
+		drainIncoming( );
+#endif // MULTI-THREADING
+
+		// Sum queues sizes.
+		std::size_t count_( 0 );
+		for ( const events_queue_t & queue_lr : mEventsQueues )
+			count_ += queue_lr.size( );
+
+		return( static_cast<std::uint32_t>( count_ ) );
+
+	}
+
+	/**
+	 * Begin frame: in double-buffered mode, swap Events Queues with
+	 * (empty) frame queues, so Events, sent while dispatching, are
+	 * queued for the next frame.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @return - number of Events to dispatch.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t EventsManager::swapQueues( ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( mEventsQueueMutex );
+#endif // MULTI-THREADING
+
+		// Events to dispatch.
+		const std::uint32_t count_( countQueued( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Double-buffered mode.
+		const bool doubleBuffered_( mDoubleBuffered.load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Double-buffered mode.
+		const bool doubleBuffered_( mDoubleBuffered );
+#endif // MULTI-THREADING
+
+		// Swap buffers.
+		if ( doubleBuffered_ )
+		{
+
+			// Swap queues, O(1).
+			for ( std::size_t priority_ = 0; priority_ < Event::PRIORITIES_COUNT; priority_++ )
+				mEventsQueues[priority_].swap( mFrameQueues[priority_] );
+
+			// Events of the frame are not replaced by next ones.
+			mCoalesced.clear( );
+
+		}
+
+		return( count_ );
+
+	}
+
+	/**
+	 * Returns coalescing key of the Event: Type-ID & target Object-ID.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t EventsManager::getCoalescingKey( const Event & pEvent ) noexcept
+	{ return( ( static_cast<std::uint32_t>( pEvent.mTypeID ) << 16 ) | pEvent.mTargetID ); }
+
+	/**
+	 * Returns 'true' if the Event replaces queued Event with the same key.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::isCoalescing( const Event & pEvent ) const noexcept
+	{
+
+		// Event without target.
+		if ( pEvent.mTargetID == INVALID_OBJECT_ID )
+			return( false );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		return( mCoalescing[pEvent.mTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		return( mCoalescing[pEvent.mTypeID] );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Replace queued Event with the same key, or add Event to queue.
+	 * Replacing Event takes place (& priority) of the replaced one.
+	 *
+	 * Pending Events counter isn't changed.
+	 *
+	 * @thread_safety - call under Events Queue thread-lock.
+	 * @param pEvent - Event, marked queued.
+	 * @return - 'true' if queued Event replaced.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::coalesceEvent( event_ptr_t & pEvent ) noexcept
+	{
+
+		// Search queued Event with the same key.
+		const std::uint32_t key_( getCoalescingKey( *pEvent ) );
+		const events_index_t::iterator index_( mCoalesced.find( key_ ) );
+
+		// Replace queued Event.
+		if ( index_ != mCoalesced.end( ) )
+		{
+
+			// Queued Event.
+			event_ptr_t & queued_lr = *index_->second;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Replaced Event can be sent again.
+			queued_lr->mQueued.store( false, std::memory_order_relaxed );
+#else // ONE-THREAD
+			// Replaced Event can be sent again.
+			queued_lr->mQueued = false;
+#endif // MULTI-THREADING
+
+			// Replace.
+			queued_lr = pEvent;
+
+			return( true );
+
+		}
+
+		// Add Event to queue of its priority, & to index.
+		events_queue_t & queue_lr = mEventsQueues[pEvent->mPriority];
+		queue_lr.push_back( pEvent );
+		mCoalesced[key_] = &queue_lr.back( );
+
+		return( false );
+
+	}
+
+	/**
+	 * Publish new IEventListeners snapshot, & retire previous one.
+	 *
+	 * @thread_safety - call under IEventListeners thread-lock.
+	 * @param pTypeID - Event Type-ID.
+	 * @param pSnapshot - new IEventListeners snapshot, or null.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::publishListeners( const TypeID & pTypeID, event_listeners_snapshot_t pSnapshot ) noexcept
+	{
+
+		// Remove empty snapshot, to skip dispatch.
+		if ( pSnapshot != nullptr && pSnapshot->empty( ) )
+			pSnapshot.reset( );
+
+		// Search batch IEventListener.
+		bool batched_( false );
+		if ( pSnapshot != nullptr )
+		{
+			for ( const event_listener_ptr_t & listener_lr : *pSnapshot )
+				batched_ = batched_ || listener_lr->handlesBatches( );
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish snapshot
+		mBatched[pTypeID].store( batched_, std::memory_order_relaxed );
+		mListenersSnapshots[pTypeID].store( pSnapshot.get( ), std::memory_order_release );
+#else // ONE-THREAD
+		// Publish snapshot
+		mBatched[pTypeID] = batched_;
+		mListenersSnapshots[pTypeID] = pSnapshot.get( );
+#endif // MULTI-THREADING
+
+		// Swap snapshot owner.
+		mEventListeners[pTypeID].swap( pSnapshot );
+
+		// Retire previous snapshot, readers may still use it.
+		if ( pSnapshot != nullptr )
+			ECSEngine::retire( std::move( pSnapshot ) );
+
+	}
+
+	/**
+	 * Publish new targeted IEventListeners snapshot, & retire previous one.
+	 *
+	 * @thread_safety - call under IEventListeners thread-lock.
+	 * @param pTypeID - Event Type-ID.
+	 * @param pTargetID - target Object-ID.
+	 * @param pSnapshot - new IEventListeners snapshot, or null.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::publishTargetedListeners( const TypeID & pTypeID, const ObjectID pTargetID, event_listeners_snapshot_t pSnapshot ) noexcept
+	{
+
+		// Remove empty snapshot, to skip dispatch.
+		if ( pSnapshot != nullptr && pSnapshot->empty( ) )
+			pSnapshot.reset( );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Targeted IEventListeners of the type.
+		TargetedListeners * targeted_( mTargeted[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Targeted IEventListeners of the type.
+		TargetedListeners * targeted_( mTargeted[pTypeID] );
+#endif // MULTI-THREADING
+
+		// Cancel
+		if ( targeted_ == nullptr && pSnapshot == nullptr )
+			return;
+
+		// Create targeted IEventListeners.
+		if ( targeted_ == nullptr )
+		{
+			targeted_ = new TargetedListeners( );
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mTargeted[pTypeID].store( targeted_, std::memory_order_release );
+#else // ONE-THREAD
+			mTargeted[pTypeID] = targeted_;
+#endif // MULTI-THREADING
+		}
+
+		// Page of the target.
+		const std::size_t pageIndex_( static_cast<std::size_t>( pTargetID ) >> TARGETS_PAGE_BITS );
+		event_listeners_ref_t * page_( targeted_->mPages[pageIndex_] );
+
+		// Create page.
+		if ( page_ == nullptr && pSnapshot != nullptr )
+		{
+			page_ = new event_listeners_ref_t[TARGETS_PAGE_SIZE]( );
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			targeted_->mPages[pageIndex_].store( page_, std::memory_order_release );
+#else // ONE-THREAD
+			targeted_->mPages[pageIndex_] = page_;
+#endif // MULTI-THREADING
+		}
+
+		// Publish snapshot
+		if ( page_ != nullptr )
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			page_[pTargetID & ( TARGETS_PAGE_SIZE - 1 )].store( pSnapshot.get( ), std::memory_order_release );
+#else // ONE-THREAD
+			page_[pTargetID & ( TARGETS_PAGE_SIZE - 1 )] = pSnapshot.get( );
+#endif // MULTI-THREADING
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Count targets with IEventListener, requiring main thread (see requiresMainThread).
+		{
+			const auto owner_ = targeted_->mOwners.find( pTargetID );
+			const bool previous_( owner_ != targeted_->mOwners.cend( ) && requiresMainThread( *owner_->second ) );
+			const bool current_( pSnapshot != nullptr && requiresMainThread( *pSnapshot ) );
+			if ( current_ && !previous_ )
+				targeted_->mMainThreadTargets.fetch_add( 1, std::memory_order_release );
+			else if ( previous_ && !current_ )
+				targeted_->mMainThreadTargets.fetch_sub( 1, std::memory_order_release );
+		}
+#endif // MULTI-THREADING
+
+		// Swap snapshot owner.
+		if ( pSnapshot != nullptr )
+			targeted_->mOwners[pTargetID].swap( pSnapshot );
+		else
+		{
+			auto owner_ = targeted_->mOwners.find( pTargetID );
+			if ( owner_ != targeted_->mOwners.end( ) )
+			{
+				pSnapshot.swap( owner_->second );
+				targeted_->mOwners.erase( owner_ );
+			}
+		}
+
+		// Retire previous snapshot, readers may still use it.
+		if ( pSnapshot != nullptr )
+			ECSEngine::retire( std::move( pSnapshot ) );
+
+	}
+
+	/**
+	 * Returns IEventListeners snapshot of the Event target, or null.
+	 *
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	const EventsManager::event_listeners_queue_t * EventsManager::getTargetedListeners( const Event & pEvent ) const noexcept
+	{
+
+		// Event without target.
+		if ( pEvent.mTargetID == INVALID_OBJECT_ID )
+			return( nullptr );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( mTargeted[pEvent.mTypeID].load( std::memory_order_acquire ) );
+		if ( targeted_ == nullptr )
+			return( nullptr );
+
+		// Page of the target.
+		const event_listeners_ref_t * const page_( targeted_->mPages[pEvent.mTargetID >> TARGETS_PAGE_BITS].load( std::memory_order_acquire ) );
+
+		// Snapshot
+		return( page_ != nullptr ? page_[pEvent.mTargetID & ( TARGETS_PAGE_SIZE - 1 )].load( std::memory_order_acquire ) : nullptr );
+#else // ONE-THREAD
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( mTargeted[pEvent.mTypeID] );
+		if ( targeted_ == nullptr )
+			return( nullptr );
+
+		// Page of the target.
+		const event_listeners_ref_t * const page_( targeted_->mPages[pEvent.mTargetID >> TARGETS_PAGE_BITS] );
+
+		// Snapshot
+		return( page_ != nullptr ? page_[pEvent.mTargetID & ( TARGETS_PAGE_SIZE - 1 )] : nullptr );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Pass Event to IEventListeners of snapshot, until handled.
+	 *
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+	 * @param pListeners - IEventListeners snapshot.
+	 * @param pEvent - Event.
+	 * @return - 'true' if Event handled.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::passEvent( const event_listeners_queue_t & pListeners, event_ptr_t & pEvent ) noexcept
+	{
+
+		// Handle Event
+		for ( const event_listener_ptr_t & listener_lr : pListeners )
+		{
+			if ( listener_lr->handlesBatches( ) )
+			{
+				// Batch of one Event.
+				Event * const event_( pEvent.get( ) );
+				event_->mHandled = false;
+				listener_lr->onEvents( &event_, 1 );
+				if ( event_->mHandled )
+					return( true );
+			}
+			else if ( listener_lr->onEvent( pEvent ) )
+				return( true );
+		}
+
+		return( false );
+
+	}
+
+	/**
+	 * Pass Event to IEventListeners, until handled.
+	 *
+	 * (?) IEventListeners snapshot loaded once, & walked without locks,
+	 * IEventListeners can be (un)registered while handling Event.
+	 *
+	 * @thread_safety - lock-free.
+	 * @param pEvent - Event.
+	 * @return - 'true' if Event handled.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::dispatchEvent( event_ptr_t & pEvent ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Keep IEventListeners snapshot alive.
+		EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+		// Targeted IEventListeners first.
+		const event_listeners_queue_t * const targeted_( instance_->getTargetedListeners( *pEvent ) );
+		if ( targeted_ != nullptr && passEvent( *targeted_, pEvent ) )
+			return( true );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// IEventListeners snapshot.
+		const event_listeners_queue_t * const listeners_( instance_->mListenersSnapshots[pEvent->mTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// IEventListeners snapshot.
+		const event_listeners_queue_t * const listeners_( instance_->mListenersSnapshots[pEvent->mTypeID] );
+#endif // MULTI-THREADING
+
+		// Handle Event
+		return( listeners_ != nullptr && passEvent( *listeners_, pEvent ) );
+
+	}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	/**
+	 * Returns 'true' if any IEventListener of the snapshot requires main thread.
+	 *
+	 * @thread_safety - call under EpochReclaimer::Guard, or IEventListeners thread-lock.
+	 * @param pListeners - IEventListeners snapshot.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::requiresMainThread( const event_listeners_queue_t & pListeners ) noexcept
+	{
+
+		// Search IEventListener, requiring main thread.
+		for ( const event_listener_ptr_t & listener_lr : pListeners )
+		{
+			if ( listener_lr->requiresMainThread( ) )
+				return( true );
+		}
+
+		return( false );
+
+	}
+
+	/**
+	 * Returns 'true' if any IEventListener of the type, including targeted
+	 * ones, requires main thread.
+	 *
+	 * @thread_safety - lock-free.
+	 * @param pTypeID - Event Type-ID.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::requiresMainThread( const TypeID & pTypeID ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Targeted IEventListeners, deleted only with EventsManager.
+		const TargetedListeners * const targeted_( instance_->mTargeted[pTypeID].load( std::memory_order_acquire ) );
+
+		// Targeted IEventListener, requiring main thread.
+		if ( targeted_ != nullptr && targeted_->mMainThreadTargets.load( std::memory_order_acquire ) > 0 )
+			return( true );
+
+		// Keep IEventListeners snapshot alive.
+		EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+		// IEventListeners snapshot.
+		const event_listeners_queue_t * const listeners_( instance_->mListenersSnapshots[pTypeID].load( std::memory_order_acquire ) );
+
+		return( listeners_ != nullptr && requiresMainThread( *listeners_ ) );
+
+	}
+
+	/**
+	 * Send all Events from queue, grouped by Type-ID, on worker threads.
+	 *
+	 * @thread_safety - call from one (main) thread, Events can be sent meanwhile.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::sendEventsParallel( ) noexcept
+	{
+
+		// Worker threads.
+		ThreadPool * const threadPool_( SystemsManager::getThreadPool( ) );
+
+		// Dispatch queued Events, & Events sent while dispatching.
+		for ( ; ; )
+		{
+
+			// Group queued Events by Type-ID, keeping order of each type.
+			for ( event_ptr_t event_sp( getNextEvent( ) ); event_sp != nullptr; event_sp = getNextEvent( ) )
+				addToBatch( event_sp );
+
+			// Stop
+			if ( mBatchTypes.empty( ) )
+				return;
+
+			// Types, dispatched on the calling thread, first.
+			auto workerTypes_ = mBatchTypes.end( );
+			if ( mBatchTypes.size( ) > 1 && threadPool_->getThreadsCount( ) > 0 )
+				workerTypes_ = std::partition( mBatchTypes.begin( ), mBatchTypes.end( ), []( const TypeID pTypeID ) { return( requiresMainThread( pTypeID ) ); } );
+
+			// Number of groups, not dispatched yet by worker threads.
+			mecs_atomic<std::size_t> remaining_( static_cast<std::size_t>( mBatchTypes.end( ) - workerTypes_ ) );
+
+			// Submit groups to worker threads.
+			for ( auto typesIter_ = workerTypes_; typesIter_ != mBatchTypes.end( ); typesIter_++ )
+			{
+				events_vectr_t * const batch_( &mBatches[*typesIter_] );
+				threadPool_->submit( [batch_, &remaining_]( )
+					{
+						dispatchBatch( *batch_ );
+						remaining_.fetch_sub( 1, std::memory_order_release );
+					} );
+			}
+
+			// Dispatch other groups.
+			for ( auto typesIter_ = mBatchTypes.begin( ); typesIter_ != workerTypes_; typesIter_++ )
+				dispatchBatch( mBatches[*typesIter_] );
+
+			// Help worker threads, until all groups dispatched.
+			while ( remaining_.load( std::memory_order_acquire ) > 0 )
+			{
+				if ( !threadPool_->runPending( ) )
+					std::this_thread::yield( );
+			}
+
+			// Collect Events to send again, & reset groups.
+			collectBatches( );
+
+		}
+
+	}
+#endif // MULTI-THREADING
+
+	/**
+	 * Returns 'true' if the type has batch IEventListeners.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @param pTypeID - Event Type-ID.
+	 * @throws - no exceptions.
+	**/
+	bool EventsManager::isBatched( const TypeID & pTypeID ) const noexcept
+	{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		return( mBatched[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		return( mBatched[pTypeID] );
+#endif // MULTI-THREADING
+	}
+
+	/**
+	 * Add Event to group of its type.
+	 *
+	 * @thread_safety - call from the dispatching thread.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::addToBatch( event_ptr_t & pEvent ) noexcept
+	{
+
+		// Events group
+		events_vectr_t & batch_lr = mBatches[pEvent->mTypeID];
+
+		// Remember type of the new group.
+		if ( batch_lr.empty( ) )
+			mBatchTypes.push_back( pEvent->mTypeID );
+
+		// Add Event
+		batch_lr.push_back( std::move( pEvent ) );
+
+	}
+
+	/**
+	 * Pass Events of one type to IEventListeners, in order. Not handled Events
+	 * with repeat flag are kept in the group, others are removed.
+	 *
+	 * (?) With batch IEventListeners, each IEventListener receives all
+	 * not handled Events, before the next one.
+	 *
+	 * @thread_safety - lock-free, one thread per group.
+	 * @param pBatch - Events group.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::dispatchBatch( events_vectr_t & pBatch ) noexcept
+	{
+
+		// Cancel
+		if ( pBatch.empty( ) )
+			return;
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Events Type-ID.
+		const TypeID typeID_( pBatch.front( )->mTypeID );
+
+		// Handle Events one by one.
+		if ( !instance_->isBatched( typeID_ ) )
+		{
+			for ( event_ptr_t & event_lr : pBatch )
+				event_lr->mHandled = dispatchEvent( event_lr );
+		}
+		else // Pass all Events to each IEventListener.
+		{
+
+			// Not handled Events, passed to batch IEventListener (per thread).
+			static thread_local mecs_vector<Event*> events_;
+
+			// Keep IEventListeners snapshot alive.
+			EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// IEventListeners snapshot.
+			const event_listeners_queue_t * const listeners_( instance_->mListenersSnapshots[typeID_].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+			// IEventListeners snapshot.
+			const event_listeners_queue_t * const listeners_( instance_->mListenersSnapshots[typeID_] );
+#endif // MULTI-THREADING
+
+			// Reset handled flags, pass Events to targeted IEventListeners first.
+			for ( event_ptr_t & event_lr : pBatch )
+			{
+				const event_listeners_queue_t * const targeted_( instance_->getTargetedListeners( *event_lr ) );
+				event_lr->mHandled = targeted_ != nullptr && passEvent( *targeted_, event_lr );
+			}
+
+			// Handle Events
+			if ( listeners_ != nullptr )
+			{
+				for ( const event_listener_ptr_t & listener_lr : *listeners_ )
+				{
+
+					// Pass not handled Events with one call.
+					if ( listener_lr->handlesBatches( ) )
+					{
+						events_.clear( );
+						for ( event_ptr_t & event_lr : pBatch )
+						{
+							if ( !event_lr->mHandled )
+								events_.push_back( event_lr.get( ) );
+						}
+						if ( !events_.empty( ) )
+							listener_lr->onEvents( events_.data( ), events_.size( ) );
+						continue;
+					}
+
+					// Pass not handled Events one by one.
+					for ( event_ptr_t & event_lr : pBatch )
+					{
+						if ( !event_lr->mHandled && listener_lr->onEvent( event_lr ) )
+							event_lr->mHandled = true;
+					}
+
+				}
+			}
+
+		}
+
+		// Number of kept Events.
+		std::size_t repeated_( 0 );
+
+		// Cache handled Events, keep not handled Events with repeat flag.
+		for ( std::size_t index_ = 0; index_ < pBatch.size( ); index_++ )
+		{
+
+			// Event
+			event_ptr_t & event_lr = pBatch[index_];
+
+			// Cache Event
+			if ( event_lr->mHandled )
+				cacheEvent( event_lr );
+			else if ( event_lr->mRepeat ) // Keep, to send again.
+			{
+				if ( repeated_ != index_ )
+					pBatch[repeated_] = std::move( event_lr );
+				repeated_++;
+			}
+
+		}
+
+		// Remove other Events, keeping memory.
+		pBatch.resize( repeated_ );
+
+	}
+
+	/**
+	 * Move Events, left in groups after dispatch, to send them again.
+	 *
+	 * @thread_safety - call from the dispatching thread.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::collectBatches( ) noexcept
+	{
+
+		// Move Events, & reset groups.
+		for ( const TypeID typeID_ : mBatchTypes )
+		{
+			events_vectr_t & batch_lr = mBatches[typeID_];
+			for ( event_ptr_t & event_lr : batch_lr )
+				mRepeated.push_back( std::move( event_lr ) );
+			batch_lr.clear( );
+		}
+
+		// Reset groups types.
+		mBatchTypes.clear( );
+
+	}
+
+	/**
+	 * Add EventChannel, if there is no EventChannel of the type yet.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pChannel - new EventChannel, deleted if not added.
+	 * @return - EventChannel of the type.
+	 * @throws - no exceptions.
+	**/
+	IEventChannel * EventsManager::addChannel( IEventChannel * const pChannel ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mChannelsMutex );
+
+		// EventChannel, added by other thread.
+		IEventChannel * const channel_( instance_->mChannels[pChannel->mTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// EventChannel, added before.
+		IEventChannel * const channel_( instance_->mChannels[pChannel->mTypeID] );
+#endif // MULTI-THREADING
+
+		// Keep existing EventChannel.
+		if ( channel_ != nullptr )
+		{
+			delete pChannel;
+			return( channel_ );
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish EventChannel
+		instance_->mChannels[pChannel->mTypeID].store( pChannel, std::memory_order_release );
+#else // ONE-THREAD
+		// Add EventChannel
+		instance_->mChannels[pChannel->mTypeID] = pChannel;
+#endif // MULTI-THREADING
+
+		// Return EventChannel
+		return( pChannel );
+
+	}
+
+	/**
+	 * Add EventPool, if there is no EventPool of the type yet.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pPool - new EventPool, deleted if not added.
+	 * @return - EventPool of the type.
+	 * @throws - no exceptions.
+	**/
+	IEventPool * EventsManager::addPool( IEventPool * const pPool ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mPoolsMutex );
+
+		// EventPool, added by other thread.
+		IEventPool * const pool_( instance_->mPools[pPool->mTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// EventPool, added before.
+		IEventPool * const pool_( instance_->mPools[pPool->mTypeID] );
+#endif // MULTI-THREADING
+
+		// Keep existing EventPool.
+		if ( pool_ != nullptr )
+		{
+			delete pPool;
+			return( pool_ );
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish EventPool
+		instance_->mPools[pPool->mTypeID].store( pPool, std::memory_order_release );
+#else // ONE-THREAD
+		// Add EventPool
+		instance_->mPools[pPool->mTypeID] = pPool;
+#endif // MULTI-THREADING
+
+		// Return EventPool
+		return( pPool );
+
+	}
+
+	/**
+	 * Search for available (for sending) Event.
+	 * Event of the type with EventPool is taken from EventPool.
+	 *
+	 * @thread_safety - thread-lock used, lock-free with EventPool.
+	 * @param pTypeID - Event Type-ID.
+	 * @return - Event, or null.
+	 * @throws - no exceptions.
+	**/
+	EventsManager::event_ptr_t EventsManager::getEvent( const TypeID & pTypeID ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// EventPool
+		IEventPool * const pool_( instance_->mPools[pTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// EventPool
+		IEventPool * const pool_( instance_->mPools[pTypeID] );
+#endif // MULTI-THREADING
+
+		// Take Event from EventPool.
+		if ( pool_ != nullptr )
+			return( pool_->acquireEvent( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mEventsMutex );
+#endif // MULTI-THREADING
+
+		// Get Events cache.
+		events_vectr_t & eventsCache_lr = instance_->mEvents[pTypeID];
+
+		// Cancel, if cache is empty.
+		if ( eventsCache_lr.empty( ) )
+			return( event_ptr_t( nullptr ) );
+
+		// Get Event
+		event_ptr_t event_sp( eventsCache_lr.back( ) ); // Copy-construct.
+
+		// Remove Event from cache.
+		eventsCache_lr.pop_back( );
+
+		// Return Event.
+		return( event_sp ); // Copy-construct.
+
+	}
+
+	/**
+	 * Returns number of queued (not sent yet) Events of the type.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @param pTypeID - Event Type-ID.
+	 * @return - number of queued Events.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t EventsManager::getPendingCount( const TypeID & pTypeID ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Counter
+		std::uint32_t count_( instance_->mPending[pTypeID].load( std::memory_order_relaxed ) );
+
+		// EventChannel
+		IEventChannel * const channel_( instance_->mChannels[pTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Counter
+		std::uint32_t count_( instance_->mPending[pTypeID] );
+
+		// EventChannel
+		IEventChannel * const channel_( instance_->mChannels[pTypeID] );
+#endif // MULTI-THREADING
+
+		// Add Events of EventChannel.
+		if ( channel_ != nullptr )
+			count_ += static_cast<std::uint32_t>( channel_->getPendingCount( ) );
+
+		// Return counter
+		return( count_ );
+
+	}
+
+	/**
+	 * Returns current tick of Events timers (see updateTimers).
 	 *
 	 * @thread_safety - thread-lock used.
-	 * @param pTypeID - Event Type-ID.
-	 * @param pIndex - index. 0 to get first IEventListener in queue.
-	 * @return - IEventListener, or null.
+	 * @return - tick.
 	 * @throws - no exceptions.
 	**/
-	EventsManager::event_listener_ptr_t EventsManager::getNextEventListener( const TypeID & pTypeID, const ObjectID & pIndex ) noexcept
+	std::uint64_t EventsManager::getTick( ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventListenersMutex );
+		mecs_ulock lock_( instance_->mTimersMutex );
 #endif // MULTI-THREADING
 
-		// Search IEventListeners queue.
-		auto queuePos_ = mInstance->mEventListeners.find( pTypeID );
-
-		// Cancel
-		if ( queuePos_ == mInstance->mEventListeners.cend( ) )
-			return( event_listener_ptr_t( nullptr ) );
-
-		// IEventListeners queue.
-		event_listeners_queue_t & queue_lr = queuePos_->second;
-
-		// Cancel
-		if ( pIndex >= queue_lr.size( ) )
-			return( event_listener_ptr_t( nullptr ) );
-
-		// Get IEventListener
-		return( queue_lr.at( pIndex ) ); // Copy-construct.
+		// Return tick
+		return( instance_->mTimers.getTick( ) );
 
 	}
 
 	/**
-	 * Returns next Event in queue, or null.
+	 * Returns number of Events, sent while dispatching by the last
+	 * sendEvents (Events cascade).
 	 *
-	 * (?) Used instead of iteration while locked, to avoid self-lock
-	 * & reduce wait-time.
+	 * @thread_safety - call from the dispatching thread.
+	 * @return - number of Events.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t EventsManager::getCascadeCount( ) noexcept
+	{ return( getInstance( )->mCascadeCount ); }
+
+	/**
+	 * Enable parallel dispatch: queued Events are grouped by Type-ID, &
+	 * groups are dispatched at the same time on worker threads.
 	 *
-	 * @thread_safety - thread-lock used.
-	 * @return - Event, or null.
+	 * @thread_safety - not thread-safe.
+	 * @param pParallel - 'true' to enable parallel dispatch.
 	 * @throws - no exceptions.
 	**/
-	EventsManager::event_ptr_t EventsManager::getNextEvent( ) noexcept
+	void EventsManager::setParallelDispatch( const bool pParallel ) noexcept
 	{
 
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		// Lock
-		mecs_ulock lock_( mInstance->mEventsQueueMutex );
+		// Set flag
+		getInstance( )->mParallel = pParallel;
+#else // ONE-THREAD
+		( void )pParallel;
 #endif // MULTI-THREADING
 
-		// Cancel, if Events queue is empty.
-		if ( mInstance->mEventsQueue.empty( ) )
-			return( event_ptr_t( nullptr ) );
-
-		// Get Event
-		event_ptr_t event_sp( mInstance->mEventsQueue.front( ) ); // Copy-construct.
-		
-		// Remove Event from queue.
-		mInstance->mEventsQueue.pop_front( );
-
-		// Return Event
-		return( event_sp ); // Copy-construct.
-
 	}
 
 	/**
-	 * Search for available (for sending) Event.
+	 * Enable Events coalescing of the type: queued Event is replaced by
+	 * the next sent Event with the same target (see Event::mTargetID).
+	 * Coalesced Event takes queue place of the replaced one.
 	 *
-	 * @thread_safety - thread-lock used.
+	 * @thread_safety - lock-free, atomic used. Set before sending Events of the type.
 	 * @param pTypeID - Event Type-ID.
-	 * @return - Event, or null.
+	 * @param pCoalescing - 'true' to enable coalescing.
 	 * @throws - no exceptions.
 	**/
-	EventsManager::event_ptr_t EventsManager::getEvent( const TypeID & pTypeID ) noexcept
+	void EventsManager::setCoalescing( const TypeID & pTypeID, const bool pCoalescing ) noexcept
 	{
 
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		// Lock
-		mecs_ulock lock_( mInstance->mEventsMutex );
+		// Set flag
+		getInstance( )->mCoalescing[pTypeID].store( pCoalescing, std::memory_order_relaxed );
+#else // ONE-THREAD
+		// Set flag
+		getInstance( )->mCoalescing[pTypeID] = pCoalescing;
 #endif // MULTI-THREADING
 
-		// Get Events cache.
-		events_vectr_t & eventsCache_lr = mInstance->mEvents[pTypeID];
-
-		// Cancel, if cache is empty.
-		if ( eventsCache_lr.empty( ) )
-			return( event_ptr_t( nullptr ) );
-
-		// Get Event
-		event_ptr_t event_sp( eventsCache_lr.back( ) ); // Copy-construct.
+	}
 
-		// Remove Event from cache.
-		eventsCache_lr.pop_back( );
+	/**
+	 * Enable double-buffered mode: sendEvents dispatches only Events,
+	 * queued before it was called.
+	 *
+	 * @thread_safety - atomic used, call between sendEvents.
+	 * @param pDoubleBuffered - 'true' to enable double-buffered mode.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::setDoubleBuffered( const bool pDoubleBuffered ) noexcept
+	{
 
-		// Return Event.
-		return( event_sp ); // Copy-construct.
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Set flag
+		getInstance( )->mDoubleBuffered.store( pDoubleBuffered, std::memory_order_relaxed );
+#else // ONE-THREAD
+		// Set flag
+		getInstance( )->mDoubleBuffered = pDoubleBuffered;
+#endif // MULTI-THREADING
 
 	}
 
@@ -225,12 +1327,15 @@ namespace mecs
 	void EventsManager::Initialize( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance != nullptr )
+		if ( world_ == nullptr || world_->mEventsManager != nullptr )
 			return;
 
 		// Create EventsManager instance.
-		mInstance = new EventsManager( );
+		world_->mEventsManager = new EventsManager( );
 
 	}
 
@@ -243,18 +1348,22 @@ namespace mecs
 	void EventsManager::Terminate( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance == nullptr )
+		if ( world_ == nullptr || world_->mEventsManager == nullptr )
 			return;
 
 		// Delete EventsManager instance.
-		delete mInstance;
-		mInstance = nullptr;
+		delete world_->mEventsManager;
+		world_->mEventsManager = nullptr;
 
 	}
 
 	/**
 	 * Add Event to cache.
+	 * Event of the type with EventPool is skipped, EventPool recycles it.
 	 *
 	 * @thread_safety - thread-lock used.
 	 * @param pEvent - Event.
@@ -263,13 +1372,24 @@ namespace mecs
 	void EventsManager::cacheEvent( event_ptr_t & pEvent ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// EventPool recycles Events.
+		if ( instance_->mPools[pEvent->mTypeID].load( std::memory_order_acquire ) != nullptr )
+			return;
+
 		// Lock
-		mecs_ulock lock_( mInstance->mEventsMutex );
+		mecs_ulock lock_( instance_->mEventsMutex );
+#else // ONE-THREAD
+		// EventPool recycles Events.
+		if ( instance_->mPools[pEvent->mTypeID] != nullptr )
+			return;
 #endif // MULTI-THREADING
 
 		// Get Events cache.
-		events_vectr_t & eventsCache_lr = mInstance->mEvents[pEvent->mTypeID];
+		events_vectr_t & eventsCache_lr = instance_->mEvents[pEvent->mTypeID];
 
 		// Add Event
 		eventsCache_lr.push_back( pEvent );
@@ -287,109 +1407,262 @@ namespace mecs
 	void EventsManager::sendEventNow( event_ptr_t & pEvent, const bool pCache ) noexcept
 	{
 
-		// IEventListener index.
-		ObjectID eventListenerIndex_( 0 );
+		// Handle Event
+		if ( dispatchEvent( pEvent ) )
+			pEvent->mHandled = true;
 
-		// Get first IEventListener.
-		event_listener_ptr_t eventListener_( getNextEventListener( pEvent->mTypeID, eventListenerIndex_ ) );
+		// Cache Event
+		if ( pCache )
+			cacheEvent( pEvent );
 
-		// Handle Event
-		while ( eventListener_ != nullptr )
+	}
+
+	/**
+	 * Add Event to queue. Event must not be queued twice at the same time.
+	 *
+	 * @thread_safety - lock-free (multi-producer), but thread-safe.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::sendEvent( event_ptr_t & pEvent ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Clamp priority.
+		if ( pEvent->mPriority >= Event::PRIORITIES_COUNT )
+			pEvent->mPriority = Event::PRIORITY_LOW;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Cancel, if Event is queued already.
+		if ( pEvent->mQueued.exchange( true, std::memory_order_relaxed ) )
+			return;
+
+		// Count pending Events, before consumer can take it (coalescing Events are replaced by consumer, see drainIncoming).
+		instance_->mPending[pEvent->mTypeID].fetch_add( 1, std::memory_order_relaxed );
+
+		// Keep Event alive while queued.
+		Event * const event_( pEvent.get( ) );
+		event_->mQueueSelf = pEvent;
+
+		// Push to incoming stack.
+		Event * head_( instance_->mIncoming.load( std::memory_order_relaxed ) );
+		do
 		{
+			event_->mQueueNext = head_;
+		}
+		while ( !instance_->mIncoming.compare_exchange_weak( head_, event_, std::memory_order_release, std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Cancel, if Event is queued already.
+		if ( pEvent->mQueued )
+			return;
+		pEvent->mQueued = true;
+
+		// Coalescing Event: replace queued Event, pending Events counter isn't changed.
+		if ( instance_->isCoalescing( *pEvent ) )
+		{
+			if ( instance_->coalesceEvent( pEvent ) )
+				return;
+		}
+		else // Add Event to queue of its priority.
+			instance_->mEventsQueues[pEvent->mPriority].push_back( pEvent );
+
+		// Count pending Events.
+		instance_->mPending[pEvent->mTypeID]++;
+#endif // MULTI-THREADING
 
-			// Handle Event
-			if ( eventListener_->onEvent( pEvent ) )
-				break;
+	}
 
-			// Increase IEventListener index.
-			eventListenerIndex_++;
+	/**
+	 * Add Event to queue at the tick (see updateTimers).
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pEvent - Event.
+	 * @param pTick - tick. Passed tick means the next update.
+	 * @return - timer ID, to cancel it (see cancelTimer).
+	 * @throws - no exceptions.
+	**/
+	std::uint64_t EventsManager::sendEventAt( event_ptr_t & pEvent, const std::uint64_t pTick ) noexcept
+	{
 
-			// Next IEventListener
-			eventListener_ = getNextEventListener( pEvent->mTypeID, eventListenerIndex_ );
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
 
-		} // Handle Event
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mTimersMutex );
+#endif // MULTI-THREADING
 
-		// Cache Event
-		if ( pCache )
-			cacheEvent( pEvent );
+		// Add timer
+		return( instance_->mTimers.add( pEvent, pTick, 0 ) );
 
 	}
 
 	/**
-	 * Add Event to queue.
+	 * Add Event to queue every period, starting after the first period.
+	 * The same Event is sent, it's skipped while queued.
 	 *
-	 * @thread_safety - lock-free, but thread-safe.
+	 * @thread_safety - thread-lock used.
 	 * @param pEvent - Event.
+	 * @param pPeriod - period, in ticks (min 1).
+	 * @return - timer ID, to cancel it (see cancelTimer).
 	 * @throws - no exceptions.
 	**/
-	void EventsManager::sendEvent( event_ptr_t & pEvent ) noexcept
+	std::uint64_t EventsManager::sendEventEvery( event_ptr_t & pEvent, const std::uint32_t pPeriod ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Period
+		const std::uint32_t period_( pPeriod > 0 ? pPeriod : 1 );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventsQueueMutex );
+		mecs_ulock lock_( instance_->mTimersMutex );
 #endif // MULTI-THREADING
 
-		// Add Event to queue.
-		mInstance->mEventsQueue.push_back( pEvent );
+		// Add timer
+		return( instance_->mTimers.add( pEvent, instance_->mTimers.getTick( ) + period_, period_ ) );
 
 	}
 
 	/**
-	 * Send all Events from queue.
+	 * Cancel delayed or periodic Event.
 	 *
-	 * @thread_safety - lock-free, but thread-safe.
+	 * @thread_safety - thread-lock used.
+	 * @param pTimerID - timer ID (see sendEventAt & sendEventEvery).
+	 * @return - 'true' if canceled, 'false' if sent or canceled already.
 	 * @throws - no exceptions.
 	**/
-	void EventsManager::sendEvents( ) noexcept
+	bool EventsManager::cancelTimer( const std::uint64_t pTimerID ) noexcept
 	{
 
-		// Get Event
-		event_ptr_t event_sp( getNextEvent( ) );
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
 
-		// Cancel
-		if ( event_sp == nullptr )
-			return;
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mTimersMutex );
+#endif // MULTI-THREADING
 
-		// Handle Events
-		while ( event_sp != nullptr )
-		{
+		// Cancel timer
+		return( instance_->mTimers.cancel( pTimerID ) );
 
-			// IEventListener index.
-			ObjectID eventListenerIndex_( 0 );
+	}
 
-			// Get IEventListener
-			event_listener_ptr_t eventLsitener_sp( getNextEventListener( event_sp->mTypeID, eventListenerIndex_ ) );
+	/**
+	 * Advance Events timers, & add due Events to queue.
+	 * Call once per tick (e.g. fixed step), before sendEvents.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTicks - number of ticks.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::updateTimers( const std::uint32_t pTicks ) noexcept
+	{
 
-			// Handle Event
-			while ( eventLsitener_sp != nullptr )
-			{
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
 
-				// Handle Event
-				if ( eventLsitener_sp->onEvent( event_sp ) )
-				{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mTimersMutex );
+#endif // MULTI-THREADING
 
-					// Cache Event
-					cacheEvent( event_sp );
+		// Send due Events (lock-free).
+		instance_->mTimers.update( pTicks, []( event_ptr_t & pEvent ) { sendEvent( pEvent ); } );
 
-					// Stop
-					break;
+	}
 
-				}
+	/**
+	 * Send all Events from queue, & dispatch EventChannels.
+	 *
+	 * @thread_safety - lock-free, but thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::sendEvents( ) noexcept
+	{
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+		// Dispatch EventChannels
+		for ( std::size_t typeID_ = 0; typeID_ < TYPES_COUNT; typeID_++ )
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			IEventChannel * const channel_( instance_->mChannels[typeID_].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+			IEventChannel * const channel_( instance_->mChannels[typeID_] );
+#endif // MULTI-THREADING
+			if ( channel_ != nullptr )
+				channel_->dispatch( );
+		}
+
+		// Begin frame.
+		const std::uint32_t frameCount_( instance_->swapQueues( ) );
+		instance_->mDispatched = 0;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Dispatch Events on worker threads.
+		if ( instance_->mParallel )
+			instance_->sendEventsParallel( );
+#endif // MULTI-THREADING
 
-				// Increase IEventListener index.
-				eventListenerIndex_++;
+		// Get Event
+		event_ptr_t event_sp( getNextEvent( ) );
 
-				// Next IEventListener
-				event_listener_ptr_t eventLsitener_sp = getNextEventListener( event_sp->mTypeID, eventListenerIndex_ );
+		// Handle Events
+		while ( event_sp != nullptr || !instance_->mBatchTypes.empty( ) )
+		{
 
-			} // Handle Event
+			// Dispatch groups, when other queued Events are handled.
+			if ( event_sp == nullptr )
+			{
+				for ( const TypeID typeID_ : instance_->mBatchTypes )
+					dispatchBatch( instance_->mBatches[typeID_] );
+				instance_->collectBatches( );
+			}
+			else if ( instance_->isBatched( event_sp->mTypeID ) ) // Group Event, for batch IEventListeners.
+				instance_->addToBatch( event_sp );
+			else if ( dispatchEvent( event_sp ) ) // Handle Event, & cache it.
+			{
+				event_sp->mHandled = true;
+				cacheEvent( event_sp );
+			}
+			else if ( event_sp->mRepeat ) // Send again, after all queued Events.
+				instance_->mRepeated.push_back( std::move( event_sp ) );
 
 			// Get next Event
 			event_sp = getNextEvent( );
 
 		} // Handle Events
 
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Double-buffered mode.
+		const bool doubleBuffered_( instance_->mDoubleBuffered.load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Double-buffered mode.
+		const bool doubleBuffered_( instance_->mDoubleBuffered );
+#endif // MULTI-THREADING
+
+		// Events cascade: dispatched after queued ones, or queued for the next frame.
+		if ( doubleBuffered_ )
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mecs_ulock lock_( instance_->mEventsQueueMutex );
+#endif // MULTI-THREADING
+			instance_->mCascadeCount = instance_->countQueued( );
+		}
+		else
+			instance_->mCascadeCount = instance_->mDispatched > frameCount_ ? instance_->mDispatched - frameCount_ : 0;
+
+		// Queue not handled Events again, keeping memory.
+		for ( event_ptr_t & repeated_sp : instance_->mRepeated )
+			sendEvent( repeated_sp );
+		instance_->mRepeated.clear( );
+
 	}
 
 	/**
@@ -403,16 +1676,76 @@ namespace mecs
 	void EventsManager::registerEventListener( const TypeID & pTypeID, event_listener_ptr_t & pListener ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mEventListenersMutex );
+#endif // MULTI-THREADING
+
+		// Current IEventListeners.
+		const event_listeners_snapshot_t & listeners_lr = instance_->mEventListeners[pTypeID];
+
+		// Copy IEventListeners.
+		event_listeners_snapshot_t snapshot_sp( listeners_lr != nullptr ? new event_listeners_queue_t( *listeners_lr ) : new event_listeners_queue_t( ) );
+
+		// Add Event Listener.
+		snapshot_sp->push_back( pListener ); // Copy-construct.
+
+		// Publish IEventListeners
+		instance_->publishListeners( pTypeID, std::move( snapshot_sp ) );
+
+	}
+
+	/**
+	 * Add IEventListener of Events with the target (see Event::mTargetID).
+	 * Targeted IEventListeners receive Event before other IEventListeners.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTypeID - Event Type-ID.
+	 * @param pTargetID - target Object-ID, INVALID_OBJECT_ID to receive all Events of the type.
+	 * @param pListener - IEventListener.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::registerEventListener( const TypeID & pTypeID, const ObjectID pTargetID, event_listener_ptr_t & pListener ) noexcept
+	{
+
+		// IEventListener of all Events of the type.
+		if ( pTargetID == INVALID_OBJECT_ID )
+		{
+			registerEventListener( pTypeID, pListener );
+			return;
+		}
+
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventListenersMutex );
+		mecs_ulock lock_( instance_->mEventListenersMutex );
+
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( instance_->mTargeted[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( instance_->mTargeted[pTypeID] );
 #endif // MULTI-THREADING
 
-		// Get Event Listeners container.
-		event_listeners_queue_t & listenersQueue_lr = mInstance->mEventListeners[pTypeID];
+		// Copy IEventListeners of the target.
+		event_listeners_snapshot_t snapshot_sp( new event_listeners_queue_t( ) );
+		if ( targeted_ != nullptr )
+		{
+			auto owner_ = targeted_->mOwners.find( pTargetID );
+			if ( owner_ != targeted_->mOwners.cend( ) )
+				*snapshot_sp = *owner_->second;
+		}
 
 		// Add Event Listener.
-		listenersQueue_lr.push_back( pListener ); // Copy-construct.
+		snapshot_sp->push_back( pListener ); // Copy-construct.
+
+		// Publish IEventListeners
+		instance_->publishTargetedListeners( pTypeID, pTargetID, std::move( snapshot_sp ) );
 
 	}
 
@@ -427,50 +1760,101 @@ namespace mecs
 	void EventsManager::unregisterEventListener( const TypeID & pTypeID, event_listener_ptr_t & pListener ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventListenersMutex );
+		mecs_ulock lock_( instance_->mEventListenersMutex );
 #endif // MULTI-THREADING
 
-		// Search IEventListeners queue.
-		auto queuePos_ = mInstance->mEventListeners.find( pTypeID );
+		// Current IEventListeners.
+		const event_listeners_snapshot_t & listeners_lr = instance_->mEventListeners[pTypeID];
 
 		// Cancel
-		if ( queuePos_ == mInstance->mEventListeners.cend( ) )
+		if ( listeners_lr == nullptr )
 			return;
 
-		// IEventListeners queue.
-		event_listeners_queue_t & eventListeners_lr = queuePos_->second;
+		// Search IEventListener
+		auto listenerPos_ = std::find( listeners_lr->cbegin( ), listeners_lr->cend( ), pListener );
+
+		// Cancel
+		if ( listenerPos_ == listeners_lr->cend( ) )
+			return;
 
-		// IEventListeners iterator.
-		auto queueIter_ = eventListeners_lr.begin( );
+		// Copy IEventListeners, except removed one (order kept).
+		event_listeners_snapshot_t snapshot_sp( new event_listeners_queue_t( ) );
+		snapshot_sp->reserve( listeners_lr->size( ) - 1 );
+		snapshot_sp->insert( snapshot_sp->end( ), listeners_lr->cbegin( ), listenerPos_ );
+		snapshot_sp->insert( snapshot_sp->end( ), listenerPos_ + 1, listeners_lr->cend( ) );
 
-		// IEventListeners queue end-iterator.
-		auto queueEndIter_ = eventListeners_lr.cend( );
+		// Publish IEventListeners
+		instance_->publishListeners( pTypeID, std::move( snapshot_sp ) );
 
-		// Search IEventListener
-		while ( queueIter_ != queueEndIter_ )
+	}
+
+	/**
+	 * Removes IEventListener of Events with the target.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTypeID - Event Type-ID.
+	 * @param pTargetID - target Object-ID.
+	 * @param pListener - IEventListener.
+	 * @throws - no exceptions.
+	**/
+	void EventsManager::unregisterEventListener( const TypeID & pTypeID, const ObjectID pTargetID, event_listener_ptr_t & pListener ) noexcept
+	{
+
+		// IEventListener of all Events of the type.
+		if ( pTargetID == INVALID_OBJECT_ID )
 		{
+			unregisterEventListener( pTypeID, pListener );
+			return;
+		}
 
-			// Check pointers-values (address).
-			if ( pListener == *queueIter_ )
-			{
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
 
-				// Swap
-				std::swap( *queueIter_, eventListeners_lr.back( ) );
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( instance_->mEventListenersMutex );
 
-				// Remove
-				eventListeners_lr.pop_back( );
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( instance_->mTargeted[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Targeted IEventListeners of the type.
+		const TargetedListeners * const targeted_( instance_->mTargeted[pTypeID] );
+#endif // MULTI-THREADING
 
-				// Stop
-				return;
+		// Cancel
+		if ( targeted_ == nullptr )
+			return;
 
-			}
+		// IEventListeners of the target.
+		auto owner_ = targeted_->mOwners.find( pTargetID );
 
-			// Next IEventListener
-			queueIter_++;
+		// Cancel
+		if ( owner_ == targeted_->mOwners.cend( ) )
+			return;
 
-		}
+		// Current IEventListeners.
+		const event_listeners_queue_t & listeners_lr = *owner_->second;
+
+		// Search IEventListener
+		auto listenerPos_ = std::find( listeners_lr.cbegin( ), listeners_lr.cend( ), pListener );
+
+		// Cancel
+		if ( listenerPos_ == listeners_lr.cend( ) )
+			return;
+
+		// Copy IEventListeners, except removed one (order kept).
+		event_listeners_snapshot_t snapshot_sp( new event_listeners_queue_t( ) );
+		snapshot_sp->reserve( listeners_lr.size( ) - 1 );
+		snapshot_sp->insert( snapshot_sp->end( ), listeners_lr.cbegin( ), listenerPos_ );
+		snapshot_sp->insert( snapshot_sp->end( ), listenerPos_ + 1, listeners_lr.cend( ) );
+
+		// Publish IEventListeners
+		instance_->publishTargetedListeners( pTypeID, pTargetID, std::move( snapshot_sp ) );
 
 	}
 
@@ -484,25 +1868,28 @@ namespace mecs
 	void EventsManager::clearEvents( const TypeID & pTypeID ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventsMutex );
+		mecs_ulock lock_( instance_->mEventsMutex );
 #endif // MULTI-THREADING
 
 		// Search Events cache.
-		auto eventsCacheIter_ = mInstance->mEvents.find( pTypeID );
+		auto eventsCacheIter_ = instance_->mEvents.find( pTypeID );
 
 		// Cancel, if not found.
-		if ( eventsCacheIter_ == mInstance->mEvents.cend( ) )
+		if ( eventsCacheIter_ == instance_->mEvents.cend( ) )
 			return;
 
 		// Remove Events from cache.
-		mInstance->mEvents.erase( eventsCacheIter_ );
+		instance_->mEvents.erase( eventsCacheIter_ );
 
 	}
 
 	/**
-	 * Remove all IEventListeners.
+	 * Remove all IEventListeners, including targeted ones.
 	 *
 	 * @thread_safety - thread-lock used.
 	 * @param pTypeID - Event Type-ID.
@@ -511,20 +1898,29 @@ namespace mecs
 	void EventsManager::clearEventListeners( const TypeID & pTypeID ) noexcept
 	{
 
+		// EventsManager of the current World.
+		EventsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mEventListenersMutex );
+		mecs_ulock lock_( instance_->mEventListenersMutex );
 #endif // MULTI-THREADING
 
-		// Search IEventListeners queue.
-		auto queuePos_ = mInstance->mEventListeners.find( pTypeID );
+		// Remove IEventListeners
+		if ( instance_->mEventListeners[pTypeID] != nullptr )
+			instance_->publishListeners( pTypeID, event_listeners_snapshot_t( nullptr ) );
 
-		// Cancel
-		if ( queuePos_ == mInstance->mEventListeners.cend( ) )
-			return;
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Targeted IEventListeners of the type.
+		TargetedListeners * const targeted_( instance_->mTargeted[pTypeID].load( std::memory_order_relaxed ) );
+#else // ONE-THREAD
+		// Targeted IEventListeners of the type.
+		TargetedListeners * const targeted_( instance_->mTargeted[pTypeID] );
+#endif // MULTI-THREADING
 
-		// Remove IEventListeners
-		mInstance->mEventListeners.erase( queuePos_ );
+		// Remove targeted IEventListeners
+		while ( targeted_ != nullptr && !targeted_->mOwners.empty( ) )
+			instance_->publishTargetedListeners( pTypeID, targeted_->mOwners.begin( )->first, event_listeners_snapshot_t( nullptr ) );
 
 	}
 
@@ -45,6 +45,26 @@
 #include "../cfg/ecs_types.hpp"
 #endif // !MECS_TYPES_HPP
 
+// Include mecs::Event
+#ifndef MECS_EVENT_HPP
+#include "Event.hpp"
+#endif // !MECS_EVENT_HPP
+
+// Include mecs::EventChannel
+#ifndef MECS_EVENT_CHANNEL_HPP
+#include "EventChannel.hpp"
+#endif // !MECS_EVENT_CHANNEL_HPP
+
+// Include mecs::EventPool
+#ifndef MECS_EVENT_POOL_HPP
+#include "EventPool.hpp"
+#endif // !MECS_EVENT_POOL_HPP
+
+// Include mecs::TimerWheel
+#ifndef MECS_TIMER_WHEEL_HPP
+#include "../utils/TimerWheel.hpp"
+#endif // !MECS_TIMER_WHEEL_HPP
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -61,6 +81,39 @@ namespace mecs
 	/**
 	 * EventsManager - manage & stores Events.
 	 * 
+	 * (?) Frequent Events should use typed EventChannels (see getChannel),
+	 * which store Events by value, instead of Events queue.
+	 * 
+	 * (?) Queued Events are dispatched by priority (see Event::mPriority),
+	 * each priority has own FIFO queue.
+	 * 
+	 * (?) Events can be sent later, or periodically (see sendEventAt &
+	 * sendEventEvery), by ticks of timing wheel (see updateTimers).
+	 * Not handled Events with Event::mRepeat are sent again by the next
+	 * sendEvents.
+	 * 
+	 * (?) Queued Events of types with batch IEventListeners (see
+	 * IEventListener::handlesBatches) are grouped, & dispatched after other
+	 * queued Events, each IEventListener receives the whole group at once.
+	 * 
+	 * (?) With parallel dispatch (see setParallelDispatch), Events of different
+	 * types are handled at the same time by worker threads.
+	 * 
+	 * (?) Events of types with EventPool (see getPool) are recycled by pool,
+	 * instead of Events cache (see getEvent & cacheEvent).
+	 * 
+	 * (?) Queued Events of coalescing types (see setCoalescing) with the same
+	 * target (see Event::mTargetID) are replaced by the latest one, when
+	 * incoming Events are moved to Events Queues by the consumer (see drainIncoming).
+	 * Coalesced Event takes queue place of the replaced one.
+	 * 
+	 * (?) In double-buffered mode (see setDoubleBuffered), Events sent while
+	 * dispatching are queued for the next sendEvents, so one frame is bounded.
+	 * 
+	 * (?) IEventListeners, registered with target Object-ID, receive only
+	 * Events with the same target (see Event::mTargetID), before other
+	 * IEventListeners of the type. Found by sparse index, without filtering.
+	 * 
 	 * @authors Denis Z. (code4un@yandex.ru)
 	 * @version 1.0
 	 * @since 21.03.2019
@@ -91,18 +144,115 @@ namespace mecs
 		/** Type-alias for IEventListeners queue. **/
 		using event_listeners_queue_t = mecs_vector<event_listener_ptr_t>;
 
-		/** Type-alias for IEventListeners_map. **/
-		using event_listeners_map_t = mecs_map<const TypeID, event_listeners_queue_t>;
+		/** Type-alias for IEventListeners snapshot pointer. **/
+		using event_listeners_snapshot_t = mecs_shared<event_listeners_queue_t>;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Type-alias for published IEventListeners snapshot, read lock-free. **/
+		using event_listeners_ref_t = mecs_atomic<const event_listeners_queue_t*>;
+#else // ONE-THREAD
+		/** Type-alias for published IEventListeners snapshot. **/
+		using event_listeners_ref_t = const event_listeners_queue_t*;
+#endif // MULTI-THREADING
 
 		/** Type-alias for Events deque. **/
 		using events_queue_t = mecs_deque<event_ptr_t>;
 
+		/** Type-alias for Events timing wheel. **/
+		using events_timers_t = TimerWheel<event_ptr_t>;
+
+		/** Type-alias for queued Events index, by coalescing key (see getCoalescingKey). **/
+		using events_index_t = mecs_hash_map<std::uint32_t, event_ptr_t*>;
+
 		// ===========================================================
-		// FIELDS
+		// CONSTANTS
 		// ===========================================================
 
-		/** EventsManager instance. **/
-		static EventsManager * mInstance;
+		/** Number of Events types. **/
+		static constexpr std::size_t TYPES_COUNT = static_cast<std::size_t>( std::numeric_limits<TypeID>::max( ) ) + 1;
+
+		/** Number of bits of target Object-ID, indexing targeted IEventListeners in page. **/
+		static constexpr std::size_t TARGETS_PAGE_BITS = 8;
+
+		/** Number of targets in targeted IEventListeners page. **/
+		static constexpr std::size_t TARGETS_PAGE_SIZE = static_cast<std::size_t>( 1 ) << TARGETS_PAGE_BITS;
+
+		/** Number of targeted IEventListeners pages. **/
+		static constexpr std::size_t TARGETS_PAGES_COUNT = ( static_cast<std::size_t>( std::numeric_limits<ObjectID>::max( ) ) + 1 ) / TARGETS_PAGE_SIZE;
+
+		// ===========================================================
+		// TYPES
+		// ===========================================================
+
+		/**
+		 * TargetedListeners - IEventListeners of one Events type, by target Object-ID.
+		 * Snapshots are published to sparse index (pages, allocated on first use),
+		 * read lock-free. Pages are kept until EventsManager is destroyed.
+		**/
+		struct TargetedListeners final
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Pages of published IEventListeners snapshots. **/
+			mecs_atomic<event_listeners_ref_t*> mPages[TARGETS_PAGES_COUNT];
+#else // ONE-THREAD
+			/** Pages of published IEventListeners snapshots. **/
+			event_listeners_ref_t * mPages[TARGETS_PAGES_COUNT];
+#endif // MULTI-THREADING
+
+			/** IEventListeners snapshots owners, by target Object-ID, accessed by writers. **/
+			mecs_hash_map<ObjectID, event_listeners_snapshot_t> mOwners;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Number of targets with IEventListener, requiring main thread. **/
+			mecs_atomic<std::size_t> mMainThreadTargets;
+#endif // MULTI-THREADING
+
+			/**
+			 * TargetedListeners constructor.
+			 *
+			 * @throws - no exceptions.
+			**/
+			explicit TargetedListeners( ) noexcept
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+				: mOwners( ),
+				mMainThreadTargets( 0 )
+#else // ONE-THREAD
+				: mOwners( )
+#endif // MULTI-THREADING
+			{
+
+				// Reset pages.
+				for ( std::size_t page_ = 0; page_ < TARGETS_PAGES_COUNT; page_++ )
+					mPages[page_] = nullptr;
+
+			}
+
+			/**
+			 * TargetedListeners destructor.
+			 *
+			 * @throws - no exceptions.
+			**/
+			~TargetedListeners( ) noexcept
+			{
+
+				// Delete pages.
+				for ( std::size_t page_ = 0; page_ < TARGETS_PAGES_COUNT; page_++ )
+					delete[] static_cast<event_listeners_ref_t*>( mPages[page_] );
+
+			}
+
+			/* @deleted TargetedListeners const copy constructor */
+			TargetedListeners( const TargetedListeners & ) = delete;
+
+			/* @deleted TargetedListeners const copy assignment operator */
+			TargetedListeners & operator=( const TargetedListeners & ) = delete;
+
+		}; // TargetedListeners
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
 
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		/** Events Mutex. **/
@@ -118,11 +268,124 @@ namespace mecs
 		/** Events map. **/
 		events_map_t mEvents;
 
-		/** Events Queue. **/
-		events_queue_t mEventsQueue;
+		/** Events Queues, by priority. **/
+		events_queue_t mEventsQueues[Event::PRIORITIES_COUNT];
 
-		/** IEventListeners map. **/
-		event_listeners_map_t mEventListeners;
+		/** Queued Events of coalescing types, by coalescing key (guarded by Events Queue Mutex). **/
+		events_index_t mCoalesced;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Coalescing types flags. **/
+		mecs_abool mCoalescing[TYPES_COUNT];
+#else // ONE-THREAD
+		/** Coalescing types flags. **/
+		bool mCoalescing[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Double-buffered mode flag. **/
+		mecs_abool mDoubleBuffered;
+#else // ONE-THREAD
+		/** Double-buffered mode flag. **/
+		bool mDoubleBuffered;
+#endif // MULTI-THREADING
+
+		/** Frame Events Queues, by priority: Events dispatched by sendEvents in double-buffered mode. **/
+		events_queue_t mFrameQueues[Event::PRIORITIES_COUNT];
+
+		/** Number of Events, dispatched by sendEvents. **/
+		std::uint32_t mDispatched;
+
+		/** Number of Events, sent while dispatching by the last sendEvents. **/
+		std::uint32_t mCascadeCount;
+
+		/** Not handled Events with repeat flag, sent again after sendEvents. **/
+		events_vectr_t mRepeated;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Timers Mutex. **/
+		mecs_mutex mTimersMutex;
+#endif // MULTI-THREADING
+
+		/** Delayed & periodic Events. **/
+		events_timers_t mTimers;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Parallel dispatch flag. **/
+		bool mParallel;
+
+		/** Types with batch IEventListeners, updated with IEventListeners snapshots. **/
+		mecs_abool mBatched[TYPES_COUNT];
+#else // ONE-THREAD
+		/** Types with batch IEventListeners, updated with IEventListeners snapshots. **/
+		bool mBatched[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+		/** Events, grouped by Type-ID for batch or parallel dispatch. **/
+		events_vectr_t mBatches[TYPES_COUNT];
+
+		/** Type-IDs of not empty Events groups. **/
+		mecs_vector<TypeID> mBatchTypes;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * Incoming Events: lock-free multi-producer stack, linked through
+		 * Events (newest first). Moved to Events Queue in bulk by the consumer.
+		**/
+		mecs_atomic<Event*> mIncoming;
+#endif // MULTI-THREADING
+
+		/**
+		 * IEventListeners snapshots owners, accessed by writers.
+		 * Snapshot is immutable, changes publish new copy.
+		**/
+		event_listeners_snapshot_t mEventListeners[TYPES_COUNT];
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** IEventListeners snapshots, read lock-free. **/
+		mecs_atomic<const event_listeners_queue_t*> mListenersSnapshots[TYPES_COUNT];
+#else // ONE-THREAD
+		/** IEventListeners snapshots. **/
+		const event_listeners_queue_t * mListenersSnapshots[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Targeted IEventListeners by Events Type-ID, created on first use. **/
+		mecs_atomic<TargetedListeners*> mTargeted[TYPES_COUNT];
+#else // ONE-THREAD
+		/** Targeted IEventListeners by Events Type-ID, created on first use. **/
+		TargetedListeners * mTargeted[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Number of queued Events of each type. **/
+		mecs_atomic<std::uint32_t> mPending[TYPES_COUNT];
+#else // ONE-THREAD
+		/** Number of queued Events of each type. **/
+		std::uint32_t mPending[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** EventChannels Mutex, used to create EventChannel. **/
+		mecs_mutex mChannelsMutex;
+
+		/** EventChannels by Events Type-ID, read lock-free. **/
+		mecs_atomic<IEventChannel*> mChannels[TYPES_COUNT];
+#else // ONE-THREAD
+		/** EventChannels by Events Type-ID. **/
+		IEventChannel * mChannels[TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** EventPools Mutex, used to create EventPool. **/
+		mecs_mutex mPoolsMutex;
+
+		/** EventPools by Events Type-ID, read lock-free. **/
+		mecs_atomic<IEventPool*> mPools[TYPES_COUNT];
+#else // ONE-THREAD
+		/** EventPools by Events Type-ID. **/
+		IEventPool * mPools[TYPES_COUNT];
+#endif // MULTI-THREADING
 
 		// ===========================================================
 		// CONSTRUCTOR
@@ -135,35 +398,242 @@ namespace mecs
 		**/
 		explicit EventsManager( ) noexcept;
 
+		/**
+		 * Returns EventsManager of the current World (see World::getCurrent).
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - EventsManager, or null.
+		 * @throws - no exceptions.
+		**/
+		static EventsManager * getInstance( ) noexcept;
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class World;
+
 		// ===========================================================
 		// GETTERS & SETTERS
 		// ===========================================================
 
 		/**
-		 * Returns next IEventListener in queue, or null.
+		 * Returns next Event in queue, or null.
+		 * Event of the highest priority is returned first.
+		 * In double-buffered mode, Event is taken from frame queues.
 		 * 
 		 * (?) Used instead of iteration while locked, to avoid self-lock
 		 * & reduce wait-time.
-		 * 
+		 *
+		 * @thread_safety - thread-lock used, lock-free in double-buffered mode.
+		 * @return - Event, or null.
+		 * @throws - no exceptions.
+		**/
+		static event_ptr_t getNextEvent( ) noexcept;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * Move incoming Events to Events Queues, in sending order.
+		 * Events of coalescing types replace queued ones (see coalesceEvent).
+		 *
+		 * @thread_safety - call under Events Queue thread-lock.
+		 * @return - 'true' if any Event moved.
+		 * @throws - no exceptions.
+		**/
+		bool drainIncoming( ) noexcept;
+#endif // MULTI-THREADING
+
+		/**
+		 * Returns number of queued Events, including incoming ones.
+		 *
+		 * @thread_safety - call under Events Queue thread-lock.
+		 * @throws - no exceptions.
+		**/
+		std::uint32_t countQueued( ) noexcept;
+
+		/**
+		 * Begin frame: in double-buffered mode, swap Events Queues with
+		 * (empty) frame queues, so Events, sent while dispatching, are
+		 * queued for the next frame.
+		 *
 		 * @thread_safety - thread-lock used.
+		 * @return - number of Events to dispatch.
+		 * @throws - no exceptions.
+		**/
+		std::uint32_t swapQueues( ) noexcept;
+
+		/**
+		 * Returns coalescing key of the Event: Type-ID & target Object-ID.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getCoalescingKey( const Event & pEvent ) noexcept;
+
+		/**
+		 * Returns 'true' if the Event replaces queued Event with the same key.
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		bool isCoalescing( const Event & pEvent ) const noexcept;
+
+		/**
+		 * Replace queued Event with the same key, or add Event to queue.
+		 * Replacing Event takes place (& priority) of the replaced one.
+		 *
+		 * Pending Events counter isn't changed.
+		 *
+		 * @thread_safety - call under Events Queue thread-lock.
+		 * @param pEvent - Event, marked queued.
+		 * @return - 'true' if queued Event replaced.
+		 * @throws - no exceptions.
+		**/
+		bool coalesceEvent( event_ptr_t & pEvent ) noexcept;
+
+		/**
+		 * Publish new IEventListeners snapshot, & retire previous one.
+		 *
+		 * @thread_safety - call under IEventListeners thread-lock.
 		 * @param pTypeID - Event Type-ID.
-		 * @param pIndex - index. 0 to get first IEventListener in queue.
-		 * @return - IEventListener, or null.
+		 * @param pSnapshot - new IEventListeners snapshot, or null.
 		 * @throws - no exceptions.
 		**/
-		static event_listener_ptr_t getNextEventListener( const TypeID & pTypeID, const ObjectID & pIndex ) noexcept;
+		void publishListeners( const TypeID & pTypeID, event_listeners_snapshot_t pSnapshot ) noexcept;
 
 		/**
-		 * Returns next Event in queue, or null.
+		 * Publish new targeted IEventListeners snapshot, & retire previous one.
+		 *
+		 * @thread_safety - call under IEventListeners thread-lock.
+		 * @param pTypeID - Event Type-ID.
+		 * @param pTargetID - target Object-ID.
+		 * @param pSnapshot - new IEventListeners snapshot, or null.
+		 * @throws - no exceptions.
+		**/
+		void publishTargetedListeners( const TypeID & pTypeID, const ObjectID pTargetID, event_listeners_snapshot_t pSnapshot ) noexcept;
+
+		/**
+		 * Returns IEventListeners snapshot of the Event target, or null.
+		 *
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		const event_listeners_queue_t * getTargetedListeners( const Event & pEvent ) const noexcept;
+
+		/**
+		 * Pass Event to IEventListeners of snapshot, until handled.
+		 *
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+		 * @param pListeners - IEventListeners snapshot.
+		 * @param pEvent - Event.
+		 * @return - 'true' if Event handled.
+		 * @throws - no exceptions.
+		**/
+		static bool passEvent( const event_listeners_queue_t & pListeners, event_ptr_t & pEvent ) noexcept;
+
+		/**
+		 * Pass Event to IEventListeners, until handled.
+		 *
+		 * (?) IEventListeners snapshot loaded once, & walked without locks,
+		 * IEventListeners can be (un)registered while handling Event.
+		 *
+		 * @thread_safety - lock-free.
+		 * @param pEvent - Event.
+		 * @return - 'true' if Event handled.
+		 * @throws - no exceptions.
+		**/
+		static bool dispatchEvent( event_ptr_t & pEvent ) noexcept;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * Returns 'true' if any IEventListener of the snapshot requires main thread.
+		 *
+		 * @thread_safety - call under EpochReclaimer::Guard, or IEventListeners thread-lock.
+		 * @param pListeners - IEventListeners snapshot.
+		 * @throws - no exceptions.
+		**/
+		static bool requiresMainThread( const event_listeners_queue_t & pListeners ) noexcept;
+
+		/**
+		 * Returns 'true' if any IEventListener of the type, including targeted
+		 * ones, requires main thread.
+		 *
+		 * @thread_safety - lock-free.
+		 * @param pTypeID - Event Type-ID.
+		 * @throws - no exceptions.
+		**/
+		static bool requiresMainThread( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Send all Events from queue, grouped by Type-ID, on worker threads.
+		 *
+		 * @thread_safety - call from one (main) thread, Events can be sent meanwhile.
+		 * @throws - no exceptions.
+		**/
+		void sendEventsParallel( ) noexcept;
+#endif // MULTI-THREADING
+
+		/**
+		 * Returns 'true' if the type has batch IEventListeners.
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @param pTypeID - Event Type-ID.
+		 * @throws - no exceptions.
+		**/
+		bool isBatched( const TypeID & pTypeID ) const noexcept;
+
+		/**
+		 * Add Event to group of its type.
+		 *
+		 * @thread_safety - call from the dispatching thread.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		void addToBatch( event_ptr_t & pEvent ) noexcept;
+
+		/**
+		 * Pass Events of one type to IEventListeners, in order. Not handled Events
+		 * with repeat flag are kept in the group, others are removed.
 		 * 
-		 * (?) Used instead of iteration while locked, to avoid self-lock
-		 * & reduce wait-time.
+		 * (?) With batch IEventListeners, each IEventListener receives all
+		 * not handled Events, before the next one.
+		 *
+		 * @thread_safety - lock-free, one thread per group.
+		 * @param pBatch - Events group.
+		 * @throws - no exceptions.
+		**/
+		static void dispatchBatch( events_vectr_t & pBatch ) noexcept;
+
+		/**
+		 * Move Events, left in groups after dispatch, to send them again.
+		 *
+		 * @thread_safety - call from the dispatching thread.
+		 * @throws - no exceptions.
+		**/
+		void collectBatches( ) noexcept;
+
+		/**
+		 * Add EventChannel, if there is no EventChannel of the type yet.
 		 *
 		 * @thread_safety - thread-lock used.
-		 * @return - Event, or null.
+		 * @param pChannel - new EventChannel, deleted if not added.
+		 * @return - EventChannel of the type.
 		 * @throws - no exceptions.
 		**/
-		static event_ptr_t getNextEvent( ) noexcept;
+		static IEventChannel * addChannel( IEventChannel * const pChannel ) noexcept;
+
+		/**
+		 * Add EventPool, if there is no EventPool of the type yet.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pPool - new EventPool, deleted if not added.
+		 * @return - EventPool of the type.
+		 * @throws - no exceptions.
+		**/
+		static IEventPool * addPool( IEventPool * const pPool ) noexcept;
 
 		// ===========================================================
 		// DELETED
@@ -204,14 +674,159 @@ namespace mecs
 
 		/**
 		 * Search for available (for sending) Event.
+		 * Event of the type with EventPool is taken from EventPool.
 		 * 
-		 * @thread_safety - thread-lock used.
+		 * @thread_safety - thread-lock used, lock-free with EventPool.
 		 * @param pTypeID - Event Type-ID.
 		 * @return - Event, or null.
 		 * @throws - no exceptions.
 		**/
 		static event_ptr_t getEvent( const TypeID & pTypeID ) noexcept;
 
+		/**
+		 * Returns number of queued (not sent yet) Events of the type,
+		 * including Events of EventChannel.
+		 * Incoming Events of coalescing types are counted until consumer replaces them (see drainIncoming).
+		 * 
+		 * @thread_safety - lock-free, atomic used.
+		 * @param pTypeID - Event Type-ID.
+		 * @return - number of queued Events.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getPendingCount( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Returns current tick of Events timers (see updateTimers).
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @return - tick.
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t getTick( ) noexcept;
+
+		/**
+		 * Returns number of Events, sent while dispatching by the last
+		 * sendEvents (Events cascade): dispatched by the same sendEvents,
+		 * or, in double-buffered mode, queued for the next one.
+		 * 
+		 * @thread_safety - call from the dispatching thread.
+		 * @return - number of Events.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getCascadeCount( ) noexcept;
+
+		/**
+		 * Enable parallel dispatch: queued Events are grouped by Type-ID, &
+		 * groups are dispatched at the same time on worker threads (see
+		 * SystemsManager::setThreadsCount). Events of one type are handled
+		 * in order, by one thread. Types with IEventListener, requiring main
+		 * thread (see IEventListener::requiresMainThread), are dispatched on
+		 * the calling thread. Order of Events of different types is not kept.
+		 * 
+		 * (?) Without multi-threading, Events are dispatched on the calling thread.
+		 * 
+		 * @thread_safety - not thread-safe.
+		 * @param pParallel - 'true' to enable parallel dispatch.
+		 * @throws - no exceptions.
+		**/
+		static void setParallelDispatch( const bool pParallel ) noexcept;
+
+		/**
+		 * Enable Events coalescing of the type: queued Event is replaced by
+		 * the next sent Event with the same target (see Event::mTargetID),
+		 * so IEventListeners receive only the latest state, once per sendEvents.
+		 * Events without target (INVALID_OBJECT_ID) are queued as usual.
+		 * 
+		 * (!) Coalesced Event takes the queue place of the Event it replaces.
+		 * Senders push coalescing Events lock-free as usual, & consumer replaces
+		 * them while moving incoming Events to Events Queues (see drainIncoming).
+		 * 
+		 * @thread_safety - lock-free, atomic used. Set before sending Events of the type.
+		 * @param pTypeID - Event Type-ID.
+		 * @param pCoalescing - 'true' to enable coalescing.
+		 * @throws - no exceptions.
+		**/
+		static void setCoalescing( const TypeID & pTypeID, const bool pCoalescing ) noexcept;
+
+		/**
+		 * Enable double-buffered mode: sendEvents dispatches only Events,
+		 * queued before it was called. Events, sent while dispatching (by
+		 * IEventListeners, or other threads), are queued for the next
+		 * sendEvents, so Events cascades can't make one frame unbounded.
+		 * Queues are swapped in O(1).
+		 * 
+		 * @thread_safety - atomic used, call between sendEvents.
+		 * @param pDoubleBuffered - 'true' to enable double-buffered mode.
+		 * @throws - no exceptions.
+		**/
+		static void setDoubleBuffered( const bool pDoubleBuffered ) noexcept;
+
+		/**
+		 * Returns EventChannel of the type, created on first use.
+		 * All calls with the same Type-ID must use the same Events type.
+		 * 
+		 * @thread_safety - lock-free, thread-lock used to create EventChannel.
+		 * @param pTypeID - Event Type-ID.
+		 * @return - EventChannel.
+		 * @throws - no exceptions.
+		**/
+		template <typename T>
+		static EventChannel<T> & getChannel( const TypeID & pTypeID ) noexcept
+		{
+
+			// EventsManager of the current World.
+			EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// EventChannel
+			IEventChannel * channel_( instance_->mChannels[pTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+			// EventChannel
+			IEventChannel * channel_( instance_->mChannels[pTypeID] );
+#endif // MULTI-THREADING
+
+			// Create EventChannel
+			if ( channel_ == nullptr )
+				channel_ = addChannel( new EventChannel<T>( pTypeID ) );
+
+			// Return EventChannel
+			return( static_cast<EventChannel<T>&>( *channel_ ) );
+
+		}
+
+		/**
+		 * Returns EventPool of the type, created on first use.
+		 * All calls with the same Type-ID must use the same Events type.
+		 * 
+		 * @thread_safety - lock-free, thread-lock used to create EventPool.
+		 * @param pTypeID - Event Type-ID.
+		 * @return - EventPool.
+		 * @throws - no exceptions.
+		**/
+		template <typename T>
+		static EventPool<T> & getPool( const TypeID & pTypeID ) noexcept
+		{
+
+			// EventsManager of the current World.
+			EventsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// EventPool
+			IEventPool * pool_( instance_->mPools[pTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+			// EventPool
+			IEventPool * pool_( instance_->mPools[pTypeID] );
+#endif // MULTI-THREADING
+
+			// Create EventPool
+			if ( pool_ == nullptr )
+				pool_ = addPool( new EventPool<T>( pTypeID ) );
+
+			// Return EventPool
+			return( static_cast<EventPool<T>&>( *pool_ ) );
+
+		}
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -234,6 +849,7 @@ namespace mecs
 
 		/**
 		 * Add Event to cache.
+		 * Event of the type with EventPool is skipped, EventPool recycles it.
 		 *
 		 * @thread_safety - thread-lock used.
 		 * @param pEvent - Event.
@@ -252,16 +868,62 @@ namespace mecs
 		static void sendEventNow( event_ptr_t & pEvent, const bool pCache ) noexcept;
 
 		/**
-		 * Add Event to queue.
+		 * Add Event to queue. Ignored, if Event is queued already.
+		 * Event of coalescing type replaces queued Event with the same target (see setCoalescing).
 		 *
-		 * @thread_safety - lock-free, but thread-safe.
+		 * @thread_safety - lock-free (multi-producer).
 		 * @param pEvent - Event.
 		 * @throws - no exceptions.
 		**/
 		static void sendEvent( event_ptr_t & pEvent ) noexcept;
 
 		/**
-		 * Send all Events from queue.
+		 * Add Event to queue at the tick (see updateTimers).
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pEvent - Event.
+		 * @param pTick - tick. Passed tick means the next update.
+		 * @return - timer ID, to cancel it (see cancelTimer).
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t sendEventAt( event_ptr_t & pEvent, const std::uint64_t pTick ) noexcept;
+
+		/**
+		 * Add Event to queue every period, starting after the first period.
+		 * The same Event is sent, it's skipped while queued.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pEvent - Event.
+		 * @param pPeriod - period, in ticks (min 1).
+		 * @return - timer ID, to cancel it (see cancelTimer).
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t sendEventEvery( event_ptr_t & pEvent, const std::uint32_t pPeriod ) noexcept;
+
+		/**
+		 * Cancel delayed or periodic Event.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pTimerID - timer ID (see sendEventAt & sendEventEvery).
+		 * @return - 'true' if canceled, 'false' if sent or canceled already.
+		 * @throws - no exceptions.
+		**/
+		static bool cancelTimer( const std::uint64_t pTimerID ) noexcept;
+
+		/**
+		 * Advance Events timers, & add due Events to queue.
+		 * Call once per tick (e.g. fixed step), before sendEvents.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pTicks - number of ticks.
+		 * @throws - no exceptions.
+		**/
+		static void updateTimers( const std::uint32_t pTicks = 1 ) noexcept;
+
+		/**
+		 * Send all Events from queue, & dispatch EventChannels.
+		 * Not handled Events with repeat flag are queued again.
+		 * In double-buffered mode, Events sent meanwhile wait for the next call.
 		 * 
 		 * @thread_safety - lock-free, but thread-safe.
 		 * @throws - no exceptions.
@@ -278,6 +940,18 @@ namespace mecs
 		**/
 		static void registerEventListener( const TypeID & pTypeID, event_listener_ptr_t & pListener ) noexcept;
 
+		/**
+		 * Add IEventListener of Events with the target (see Event::mTargetID).
+		 * Targeted IEventListeners receive Event before other IEventListeners.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pTypeID - Event Type-ID.
+		 * @param pTargetID - target Object-ID, INVALID_OBJECT_ID to receive all Events of the type.
+		 * @param pListener - IEventListener.
+		 * @throws - no exceptions.
+		**/
+		static void registerEventListener( const TypeID & pTypeID, const ObjectID pTargetID, event_listener_ptr_t & pListener ) noexcept;
+
 		/**
 		 * Removes IEventListener.
 		 * 
@@ -288,6 +962,17 @@ namespace mecs
 		**/
 		static void unregisterEventListener( const TypeID & pTypeID, event_listener_ptr_t & pListener ) noexcept;
 
+		/**
+		 * Removes IEventListener of Events with the target.
+		 * 
+		 * @thread_safety - thread-lock used.
+		 * @param pTypeID - Event Type-ID.
+		 * @param pTargetID - target Object-ID.
+		 * @param pListener - IEventListener.
+		 * @throws - no exceptions.
+		**/
+		static void unregisterEventListener( const TypeID & pTypeID, const ObjectID pTargetID, event_listener_ptr_t & pListener ) noexcept;
+
 		/**
 		 * Remove all cached Events.
 		 * 
@@ -298,7 +983,7 @@ namespace mecs
 		static void clearEvents( const TypeID & pTypeID ) noexcept;
 
 		/**
-		 * Remove all IEventListeners.
+		 * Remove all IEventListeners, including targeted ones.
 		 * 
 		 * @thread_safety - thread-lock used.
 		 * @param pTypeID - Event Type-ID.
@@ -83,6 +83,31 @@ namespace mecs
 		**/
 		virtual ~IEventListener( ) noexcept = default;
 
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns 'true' if Events must be handled on the main (calling
+		 * sendEvents) thread, e.g. rendering or UI.
+		 * Used by parallel dispatch (see EventsManager::setParallelDispatch).
+		 * 
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		virtual bool requiresMainThread( ) const noexcept
+		{ return( false ); }
+
+		/**
+		 * Returns 'true' to receive Events in batches (see onEvents), instead
+		 * of onEvent. Checked when IEventListener is registered.
+		 * 
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		virtual bool handlesBatches( ) const noexcept
+		{ return( false ); }
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -97,6 +122,23 @@ namespace mecs
 		**/
 		virtual bool onEvent( mecs_shared<Event> & pEvent ) noexcept = 0;
 
+		/**
+		 * Called with all queued (not handled yet) Events of the type, in order,
+		 * once per dispatch, if IEventListener handles batches (see handlesBatches).
+		 * Set Event::mHandled of handled Events, to stop passing them to
+		 * next IEventListeners.
+		 * 
+		 * @thread_safety - not required, async-queue used.
+		 * @param pEvents - Events.
+		 * @param pCount - number of Events.
+		 * @throws - no exceptions.
+		**/
+		virtual void onEvents( Event * const * const pEvents, const std::size_t pCount ) noexcept
+		{
+			( void )pEvents;
+			( void )pCount;
+		}
+
 		// -----------------------------------------------------------
 
 	}; // mecs::IEventListener
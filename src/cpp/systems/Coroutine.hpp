@@ -0,0 +1,419 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef MECS_COROUTINE_HPP
+#define MECS_COROUTINE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+#ifdef MECS_LIB_COROUTINES // COROUTINES
+
+// Include C++ coroutine
+#include <coroutine>
+
+// Include C++ exception
+#include <exception>
+
+// Include C++ new
+#include <new>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::CoroutineFramesPool
+	// ===========================================================
+
+	/**
+	 * CoroutineFramesPool - pooled allocator of coroutine frames. Frames are
+	 * rounded up to size classes & recycled through per-thread free-lists, so
+	 * starting & finishing coroutines doesn't touch global heap, nor any lock.
+	 * Frames bigger than the largest size class use global heap.
+	 * 
+	 * (?) Each free-list keeps up to MAX_FREE_FRAMES frames, extra frames are
+	 * released to global heap, so a burst of Tasks doesn't pin memory.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class CoroutineFramesPool final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Size class granularity, in bytes. **/
+		static constexpr const std::size_t CLASS_SIZE = 64;
+
+		/** Number of size classes (frames up to 2 KiB are pooled). **/
+		static constexpr const std::size_t CLASSES_COUNT = 32;
+
+		/** Max number of free frames, kept per size class & thread. **/
+		static constexpr const std::size_t MAX_FREE_FRAMES = 256;
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Free frame, reused as free-list node. **/
+		struct Node
+		{
+
+			/** Next free frame. **/
+			Node * mNext;
+
+		}; // mecs::CoroutineFramesPool::Node
+
+		/** Per-thread free-lists, released on thread exit. **/
+		struct Cache final
+		{
+
+			/** Free-lists of each size class. **/
+			Node * mFree[CLASSES_COUNT] = { };
+
+			/** Number of free frames of each size class. **/
+			std::size_t mFreeCount[CLASSES_COUNT] = { };
+
+			/** Release free frames. **/
+			~Cache( ) noexcept
+			{
+				for ( std::size_t class_ = 0; class_ < CLASSES_COUNT; class_++ )
+				{
+					while ( mFree[class_] != nullptr )
+					{
+						Node * const node_( mFree[class_] );
+						mFree[class_] = node_->mNext;
+						::operator delete( node_ );
+					}
+				}
+			}
+
+		}; // mecs::CoroutineFramesPool::Cache
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns free-lists of the calling thread.
+		 *
+		 * @thread_safety - thread-local.
+		 * @throws - no exceptions.
+		**/
+		static Cache & getCache( ) noexcept
+		{
+			static thread_local Cache cache_;
+			return( cache_ );
+		}
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Allocate frame.
+		 *
+		 * @thread_safety - thread-local free-lists used.
+		 * @param pSize - frame size, in bytes.
+		 * @return - frame, or null if out of memory.
+		 * @throws - no exceptions.
+		**/
+		static void * allocate( const std::size_t pSize ) noexcept
+		{
+
+			// Size class
+			const std::size_t class_( ( pSize + CLASS_SIZE - 1 ) / CLASS_SIZE - 1 );
+
+			// Big frame
+			if ( class_ >= CLASSES_COUNT )
+				return( ::operator new( pSize, std::nothrow ) );
+
+			// Reuse free frame.
+			Cache & cache_lr( getCache( ) );
+			Node * const node_( cache_lr.mFree[class_] );
+			if ( node_ != nullptr )
+			{
+				cache_lr.mFree[class_] = node_->mNext;
+				cache_lr.mFreeCount[class_]--;
+				return( node_ );
+			}
+
+			// Allocate whole size class, so frame can be reused by any frame of the class.
+			return( ::operator new( ( class_ + 1 ) * CLASS_SIZE, std::nothrow ) );
+
+		}
+
+		/**
+		 * Release frame to the calling thread free-list.
+		 *
+		 * @thread_safety - thread-local free-lists used.
+		 * @param pFrame - frame.
+		 * @param pSize - frame size, in bytes.
+		 * @throws - no exceptions.
+		**/
+		static void deallocate( void * const pFrame, const std::size_t pSize ) noexcept
+		{
+
+			// Size class
+			const std::size_t class_( ( pSize + CLASS_SIZE - 1 ) / CLASS_SIZE - 1 );
+
+			// Big frame
+			if ( class_ >= CLASSES_COUNT )
+			{
+				::operator delete( pFrame );
+				return;
+			}
+
+			// Release frame, if free-list is full.
+			Cache & cache_lr( getCache( ) );
+			if ( cache_lr.mFreeCount[class_] >= MAX_FREE_FRAMES )
+			{
+				::operator delete( pFrame );
+				return;
+			}
+
+			// Push to free-list.
+			Node * const node_( static_cast<Node*>( pFrame ) );
+			node_->mNext = cache_lr.mFree[class_];
+			cache_lr.mFree[class_] = node_;
+			cache_lr.mFreeCount[class_]++;
+
+		}
+
+		// -----------------------------------------------------------
+
+	}; // mecs::CoroutineFramesPool
+
+	// ===========================================================
+	// mecs::CoroutineTask
+	// ===========================================================
+
+	/**
+	 * CoroutineTask - coroutine, which is updated by CoroutinesSystem across
+	 * frames (see CoroutinesSystem::start). Task is suspended on start, &
+	 * its frame is allocated from CoroutineFramesPool.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class CoroutineTask final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Coroutine promise. **/
+		struct promise_type
+		{
+
+			/** CoroutinesSystem, which updates this Task. **/
+			CoroutinesSystem * mScheduler = nullptr;
+
+			/** Returns Task. **/
+			CoroutineTask get_return_object( ) noexcept
+			{ return( CoroutineTask( std::coroutine_handle<promise_type>::from_promise( *this ) ) ); }
+
+			/** Returns empty Task, if frame can't be allocated. **/
+			static CoroutineTask get_return_object_on_allocation_failure( ) noexcept
+			{ return( CoroutineTask( nullptr ) ); }
+
+			/** Suspend until started by CoroutinesSystem. **/
+			std::suspend_always initial_suspend( ) const noexcept
+			{ return( std::suspend_always( ) ); }
+
+			/** Suspend when done, so CoroutinesSystem destroys frame. **/
+			std::suspend_always final_suspend( ) const noexcept
+			{ return( std::suspend_always( ) ); }
+
+			/** Done. **/
+			void return_void( ) const noexcept
+			{ }
+
+			/** Exceptions are not supported. **/
+			void unhandled_exception( ) const noexcept
+			{ std::terminate( ); }
+
+			/** Allocate frame from pool. **/
+			static void * operator new( const std::size_t pSize ) noexcept
+			{ return( CoroutineFramesPool::allocate( pSize ) ); }
+
+			/** Release frame to pool. **/
+			static void operator delete( void * const pFrame, const std::size_t pSize ) noexcept
+			{ CoroutineFramesPool::deallocate( pFrame, pSize ); }
+
+		}; // mecs::CoroutineTask::promise_type
+
+		/** Type-alias for coroutine handle. **/
+		using handle_t = std::coroutine_handle<promise_type>;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CoroutineTask constructor.
+		 *
+		 * @param pHandle - coroutine handle.
+		 * @throws - no exceptions.
+		**/
+		explicit CoroutineTask( const handle_t pHandle ) noexcept
+			: mHandle( pHandle )
+		{
+		}
+
+		/**
+		 * CoroutineTask move constructor.
+		 *
+		 * @param pOther - Task to move from.
+		 * @throws - no exceptions.
+		**/
+		CoroutineTask( CoroutineTask && pOther ) noexcept
+			: mHandle( pOther.release( ) )
+		{
+		}
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CoroutineTask destructor. Destroys coroutine, if it wasn't started.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~CoroutineTask( ) noexcept
+		{
+			if ( mHandle )
+				mHandle.destroy( );
+		}
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Release coroutine handle ownership.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @return - coroutine handle, or null.
+		 * @throws - no exceptions.
+		**/
+		handle_t release( ) noexcept
+		{
+			const handle_t handle_( mHandle );
+			mHandle = nullptr;
+			return( handle_ );
+		}
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Coroutine handle. **/
+		handle_t mHandle;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		CoroutineTask( const CoroutineTask & ) = delete;
+		CoroutineTask & operator=( const CoroutineTask & ) = delete;
+		CoroutineTask & operator=( CoroutineTask && ) = delete;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::CoroutineTask
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_COROUTINE_TASK_DECL
+#define MECS_COROUTINE_TASK_DECL
+using mecs_CoroutineTask = mecs::CoroutineTask;
+#endif // !MECS_COROUTINE_TASK_DECL
+
+#endif // COROUTINES
+
+// -----------------------------------------------------------
+
+#endif // !MECS_COROUTINE_HPP
@@ -0,0 +1,494 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef MECS_COROUTINES_SYSTEM_HPP
+#include "CoroutinesSystem.hpp"
+#endif // !MECS_COROUTINES_SYSTEM_HPP
+
+#ifdef MECS_LIB_COROUTINES // COROUTINES
+
+// Include mecs::Event
+#ifndef MECS_EVENT_HPP
+#include "../events/Event.hpp"
+#endif // !MECS_EVENT_HPP
+
+// Include mecs::EventsManager
+#ifndef MECS_EVENTS_MANAGER_HPP
+#include "../events/EventsManager.hpp"
+#endif // !MECS_EVENTS_MANAGER_HPP
+
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// mecs::CoroutinesSystem
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// AWAITABLES
+	// ===========================================================
+
+	/**
+	 * Delays heap order: the earliest resume time on top.
+	 *
+	 * @param pA - delayed Task.
+	 * @param pB - delayed Task.
+	 * @return - 'true' if pA is resumed later than pB.
+	 * @throws - no exceptions.
+	**/
+	static bool compareDelayed( const std::pair<double, CoroutineTask::handle_t> & pA, const std::pair<double, CoroutineTask::handle_t> & pB ) noexcept
+	{ return( pA.first > pB.first ); }
+
+	/**
+	 * Schedule Task to the next frame.
+	 *
+	 * @thread_safety - called from the updating thread.
+	 * @param pHandle - coroutine handle.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::NextFrame::await_suspend( const handle_t pHandle ) const noexcept
+	{ getScheduler( pHandle ).mNext.push_back( pHandle ); }
+
+	/**
+	 * Schedule Task to the delays heap.
+	 *
+	 * @thread_safety - called from the updating thread.
+	 * @param pHandle - coroutine handle.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::Delay::await_suspend( const handle_t pHandle ) const noexcept
+	{
+
+		// CoroutinesSystem of the Task.
+		CoroutinesSystem & scheduler_lr( getScheduler( pHandle ) );
+
+		// Push to min-heap.
+		scheduler_lr.mDelayed.push_back( delayed_t( scheduler_lr.mTime + mSeconds, pHandle ) );
+		std::push_heap( scheduler_lr.mDelayed.begin( ), scheduler_lr.mDelayed.end( ), compareDelayed );
+
+	}
+
+	/**
+	 * Add Task to the Event waiters, & listen Events of the type.
+	 *
+	 * @thread_safety - called from the updating thread, thread-lock used.
+	 * @param pHandle - coroutine handle.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::WaitEvent::await_suspend( const handle_t pHandle ) noexcept
+	{
+
+		// CoroutinesSystem of the Task.
+		CoroutinesSystem & scheduler_lr( getScheduler( pHandle ) );
+
+		// Waiting Task.
+		mHandle = pHandle;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( scheduler_lr.mWaitersMutex );
+#endif // MULTI-THREADING
+
+		// Add waiter
+		scheduler_lr.mWaiters[mTypeID].push_back( this );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Unlock, EventsManager locks its own mutex.
+		lock_.unlock( );
+#endif // MULTI-THREADING
+
+		// Listen Events of the type, once.
+		if ( !scheduler_lr.mListened.test( mTypeID ) )
+		{
+			scheduler_lr.mListened.set( mTypeID );
+			mecs_shared<IEventListener> listener_( scheduler_lr.mLink );
+			EventsManager::registerEventListener( mTypeID, listener_ );
+		}
+
+	}
+
+	// ===========================================================
+	// EventsLink
+	// ===========================================================
+
+	/**
+	 * EventsLink constructor.
+	 *
+	 * @param pSystem - CoroutinesSystem.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::EventsLink::EventsLink( CoroutinesSystem * const pSystem ) noexcept
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		: mMutex( ),
+		mSystem( pSystem )
+#else // ONE-THREAD
+		: mSystem( pSystem )
+#endif // MULTI-THREADING
+	{
+	}
+
+	/**
+	 * Pass Event to the CoroutinesSystem waiters.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pEvent - Event.
+	 * @return - 'false', so other IEventListeners receive Event too.
+	 * @throws - no exceptions.
+	**/
+	bool CoroutinesSystem::EventsLink::onEvent( event_ptr_t & pEvent ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( mMutex );
+#endif // MULTI-THREADING
+
+		// Pass Event, if CoroutinesSystem is alive.
+		if ( mSystem != nullptr )
+			mSystem->onWaitedEvent( pEvent );
+
+		// Don't consume Event.
+		return( false );
+
+	}
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CoroutinesSystem constructor.
+	 *
+	 * @param pTypeID - System Type-ID.
+	 * @param pPhase - update phase.
+	 * @param pPriority - update priority in the phase, lower is updated first.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::CoroutinesSystem( const TypeID & pTypeID, const SystemPhase pPhase, const std::int32_t pPriority ) noexcept
+		: System( pTypeID, pPhase, pPriority ),
+		mTime( 0.0 ),
+		mTasksCount( 0 ),
+		mReady( ),
+		mNext( ),
+		mDelayed( ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mWaitersMutex( ),
+#endif // MULTI-THREADING
+		mWaiters( ),
+		mReceived( ),
+		mListened( ),
+		mLink( std::make_shared<EventsLink>( this ) )
+	{
+
+		// Enabled by default.
+		mEnabled = true;
+
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	 * CoroutinesSystem destructor. Unregisters EventsLink & destroys unfinished Tasks.
+	 *
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::~CoroutinesSystem( ) noexcept
+	{
+
+		// Detach EventsLink, so Events, being sent now, aren't passed to destroyed System.
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mecs_ulock lock_( mLink->mMutex );
+#endif // MULTI-THREADING
+			mLink->mSystem = nullptr;
+		}
+
+		// Unregister EventsLink from each listened Events type, if World is still alive.
+		if ( World::getCurrent( ) != nullptr )
+		{
+			mecs_shared<IEventListener> listener_( mLink );
+			for ( std::size_t typeID_ = 0; typeID_ < mListened.size( ); typeID_++ )
+			{
+				if ( mListened.test( typeID_ ) )
+					EventsManager::unregisterEventListener( static_cast<TypeID>( typeID_ ), listener_ );
+			}
+		}
+
+		// Destroy Tasks. Each suspended Task is stored in exactly one list.
+		for ( const handle_t handle_ : mNext )
+			handle_.destroy( );
+		for ( const handle_t handle_ : mReceived )
+			handle_.destroy( );
+		for ( const delayed_t & delayed_lr : mDelayed )
+			delayed_lr.second.destroy( );
+		for ( auto & waitersPair_lr : mWaiters )
+		{
+			for ( WaitEvent * const waiter_ : waitersPair_lr.second )
+				waiter_->mHandle.destroy( );
+		}
+
+	}
+
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+
+	/**
+	 * Returns number of started, not finished Tasks.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @throws - no exceptions.
+	**/
+	std::size_t CoroutinesSystem::getTasksCount( ) const noexcept
+	{ return( mTasksCount ); }
+
+	/**
+	 * Enabled || Disable System.
+	 *
+	 * @thread_safety - atomic-flag used.
+	 * @param pEnabled - 'true' to Enable, 'false' to Disable.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::setEnabled( const bool pEnabled ) noexcept
+	{ mEnabled = pEnabled; }
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Returns CoroutinesSystem of the Task.
+	 *
+	 * @thread_safety - not required.
+	 * @param pHandle - coroutine handle.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem & CoroutinesSystem::getScheduler( const handle_t pHandle ) noexcept
+	{ return( *pHandle.promise( ).mScheduler ); }
+
+	/**
+	 * Resume Event waiters on the next frame.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pEvent - Event.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::onWaitedEvent( event_ptr_t & pEvent ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( mWaitersMutex );
+#endif // MULTI-THREADING
+
+		// Search waiters
+		auto waitersPos_ = mWaiters.find( pEvent->mTypeID );
+
+		// Cancel
+		if ( waitersPos_ == mWaiters.end( ) )
+			return;
+
+		// Pass Event & move waiters to received list.
+		for ( WaitEvent * const waiter_ : waitersPos_->second )
+		{
+			waiter_->mEvent = pEvent;
+			mReceived.push_back( waiter_->mHandle );
+		}
+
+		// Remove waiters
+		mWaiters.erase( waitersPos_ );
+
+	}
+
+	/**
+	 * Returns awaitable, which resumes Task on the next frame.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::NextFrame CoroutinesSystem::nextFrame( ) noexcept
+	{ return( NextFrame( ) ); }
+
+	/**
+	 * Returns awaitable, which resumes Task after delay.
+	 *
+	 * @thread_safety - not required.
+	 * @param pSeconds - delay, in seconds of the System time.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::Delay CoroutinesSystem::delay( const float pSeconds ) noexcept
+	{ return( Delay{ pSeconds } ); }
+
+	/**
+	 * Returns awaitable, which resumes Task after Event is sent.
+	 *
+	 * @thread_safety - not required.
+	 * @param pTypeID - Event Type-ID.
+	 * @throws - no exceptions.
+	**/
+	CoroutinesSystem::WaitEvent CoroutinesSystem::waitEvent( const TypeID & pTypeID ) noexcept
+	{ return( WaitEvent{ pTypeID, nullptr, nullptr } ); }
+
+	/**
+	 * Start Task. Task is resumed on the next update.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pTask - Task.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::start( CoroutineTask pTask ) noexcept
+	{
+
+		// Take ownership
+		const handle_t handle_( pTask.release( ) );
+
+		// Cancel, if frame wasn't allocated.
+		if ( !handle_ )
+			return;
+
+		// Bind Task to this System.
+		handle_.promise( ).mScheduler = this;
+
+		// Resume on the next update.
+		mNext.push_back( handle_ );
+		mTasksCount++;
+
+	}
+
+	/**
+	 * Resume ready Tasks in one batch.
+	 *
+	 * @thread_safety - called by SystemsManager.
+	 * @param pDeltaTime - elapsed time since previous update, in seconds.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::update( const float pDeltaTime ) noexcept
+	{
+
+		// System time
+		mTime += pDeltaTime;
+
+		// Tasks of the previous frame. Tasks, awaiting next frame now, go to the empty list.
+		mReady.swap( mNext );
+
+		// Tasks with Events received.
+		{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			mecs_ulock lock_( mWaitersMutex );
+#endif // MULTI-THREADING
+			mReady.insert( mReady.end( ), mReceived.cbegin( ), mReceived.cend( ) );
+			mReceived.clear( );
+		}
+
+		// Tasks with elapsed delay.
+		while ( !mDelayed.empty( ) && mDelayed.front( ).first <= mTime )
+		{
+			mReady.push_back( mDelayed.front( ).second );
+			std::pop_heap( mDelayed.begin( ), mDelayed.end( ), compareDelayed );
+			mDelayed.pop_back( );
+		}
+
+		// Resume Tasks, & destroy finished ones.
+		for ( const handle_t handle_ : mReady )
+		{
+			handle_.resume( );
+			if ( handle_.done( ) )
+			{
+				handle_.destroy( );
+				mTasksCount--;
+			}
+		}
+
+		// Clear, keeping allocated memory.
+		mReady.clear( );
+
+	}
+
+	/**
+	 * Components are not used.
+	 *
+	 * @thread_safety - not required.
+	 * @param pTypeID - Component Type-ID.
+	 * @param pComponent - Component.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::addComponent( const TypeID & pTypeID, compoent_ptr & pComponent ) noexcept
+	{
+
+		// Unused.
+		( void )pTypeID;
+		( void )pComponent;
+
+	}
+
+	/**
+	 * Components are not used.
+	 *
+	 * @thread_safety - not required.
+	 * @param pTypeID - Component Type-ID.
+	 * @param pID - Component ID.
+	 * @throws - no exceptions.
+	**/
+	void CoroutinesSystem::removeComponent( const TypeID & pTypeID, const ObjectID & pID ) noexcept
+	{
+
+		// Unused.
+		( void )pTypeID;
+		( void )pID;
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+#endif // COROUTINES
+
+// -----------------------------------------------------------
@@ -0,0 +1,425 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef MECS_COROUTINES_SYSTEM_HPP
+#define MECS_COROUTINES_SYSTEM_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+#ifdef MECS_LIB_COROUTINES // COROUTINES
+
+// Include mecs::System
+#ifndef MECS_SYSTEM_HPP
+#include "System.hpp"
+#endif // !MECS_SYSTEM_HPP
+
+// Include mecs::CoroutineTask
+#ifndef MECS_COROUTINE_HPP
+#include "Coroutine.hpp"
+#endif // !MECS_COROUTINE_HPP
+
+// Include mecs::IEventListener
+#ifndef MECS_I_EVENT_LISTENER_HPP
+#include "../events/IEventListener.hxx"
+#endif // !MECS_I_EVENT_LISTENER_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::CoroutinesSystem
+	// ===========================================================
+
+	/**
+	 * CoroutinesSystem - updates CoroutineTasks (scripts), which are sequential
+	 * over several frames: Task awaits next frame, delay, or Event.
+	 * 
+	 * (?) Tasks, ready in the frame, are resumed in one batch from the System
+	 * update. Waiting Tasks cost nothing: they are stored in the next-frame list,
+	 * delays heap, or Event waiters list, until ready.
+	 * 
+	 * (?) Task is owned by the System after start: finished Tasks are destroyed
+	 * by update, unfinished Tasks by the System destructor.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class CoroutinesSystem : public System
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for coroutine handle. **/
+		using handle_t = CoroutineTask::handle_t;
+
+		/** Type-alias for Event pointer. **/
+		using event_ptr_t = mecs_shared<Event>;
+
+		/** Awaitable: resume on the next frame. **/
+		struct NextFrame
+		{
+
+			/** Always suspend. **/
+			bool await_ready( ) const noexcept
+			{ return( false ); }
+
+			/** Schedule Task to the next frame. **/
+			void await_suspend( const handle_t pHandle ) const noexcept;
+
+			/** Nothing to return. **/
+			void await_resume( ) const noexcept
+			{ }
+
+		}; // mecs::CoroutinesSystem::NextFrame
+
+		/** Awaitable: resume after delay. **/
+		struct Delay
+		{
+
+			/** Delay, in seconds of the System time. **/
+			float mSeconds;
+
+			/** Don't suspend without delay. **/
+			bool await_ready( ) const noexcept
+			{ return( mSeconds <= 0.0f ); }
+
+			/** Schedule Task to the delays heap. **/
+			void await_suspend( const handle_t pHandle ) const noexcept;
+
+			/** Nothing to return. **/
+			void await_resume( ) const noexcept
+			{ }
+
+		}; // mecs::CoroutinesSystem::Delay
+
+		/** Awaitable: resume on the first frame after Event is sent. **/
+		struct WaitEvent
+		{
+
+			/** Event Type-ID. **/
+			TypeID mTypeID;
+
+			/** Received Event. **/
+			event_ptr_t mEvent;
+
+			/** Waiting Task. **/
+			handle_t mHandle;
+
+			/** Always suspend. **/
+			bool await_ready( ) const noexcept
+			{ return( false ); }
+
+			/** Add Task to the Event waiters. **/
+			void await_suspend( const handle_t pHandle ) noexcept;
+
+			/** Returns received Event. **/
+			event_ptr_t await_resume( ) noexcept
+			{ return( std::move( mEvent ) ); }
+
+		}; // mecs::CoroutinesSystem::WaitEvent
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/**
+		 * EventsLink - IEventListener, which passes awaited Events to the
+		 * CoroutinesSystem, while it's alive.
+		**/
+		class EventsLink final : public IEventListener
+		{
+
+		public:
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Mutex **/
+			mecs_mutex mMutex;
+#endif // MULTI-THREADING
+
+			/** CoroutinesSystem, or null if destroyed. **/
+			CoroutinesSystem * mSystem;
+
+			/**
+			 * EventsLink constructor.
+			 *
+			 * @param pSystem - CoroutinesSystem.
+			 * @throws - no exceptions.
+			**/
+			explicit EventsLink( CoroutinesSystem * const pSystem ) noexcept;
+
+			/**
+			 * Pass Event to the CoroutinesSystem waiters.
+			 *
+			 * @thread_safety - thread-lock used.
+			 * @param pEvent - Event.
+			 * @return - 'false', so other IEventListeners receive Event too.
+			 * @throws - no exceptions.
+			**/
+			virtual bool onEvent( event_ptr_t & pEvent ) noexcept final;
+
+		}; // mecs::CoroutinesSystem::EventsLink
+
+		/** Type-alias for delayed Task: resume time & handle. **/
+		using delayed_t = std::pair<double, handle_t>;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** System time, sum of updates delta-time, in seconds. **/
+		double mTime;
+
+		/** Number of started, not finished Tasks. **/
+		std::size_t mTasksCount;
+
+		/** Tasks, resumed in the current frame. **/
+		mecs_vector<handle_t> mReady;
+
+		/** Tasks, resumed in the next frame. **/
+		mecs_vector<handle_t> mNext;
+
+		/** Delayed Tasks, min-heap by resume time. **/
+		mecs_vector<delayed_t> mDelayed;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Event waiters mutex. **/
+		mecs_mutex mWaitersMutex;
+#endif // MULTI-THREADING
+
+		/** Event waiters by Event Type-ID. **/
+		mecs_map<TypeID, mecs_vector<WaitEvent*>> mWaiters;
+
+		/** Tasks, which received Events, resumed in the next frame. **/
+		mecs_vector<handle_t> mReceived;
+
+		/** Events types, for which EventsLink is registered. **/
+		mecs_types_set mListened;
+
+		/** EventsLink. **/
+		mecs_shared<EventsLink> mLink;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns CoroutinesSystem of the Task.
+		 *
+		 * @thread_safety - not required.
+		 * @param pHandle - coroutine handle.
+		 * @throws - no exceptions.
+		**/
+		static CoroutinesSystem & getScheduler( const handle_t pHandle ) noexcept;
+
+		/**
+		 * Resume Event waiters.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pEvent - Event.
+		 * @throws - no exceptions.
+		**/
+		void onWaitedEvent( event_ptr_t & pEvent ) noexcept;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CoroutinesSystem constructor.
+		 *
+		 * @param pTypeID - System Type-ID.
+		 * @param pPhase - update phase.
+		 * @param pPriority - update priority in the phase, lower is updated first.
+		 * @throws - no exceptions.
+		**/
+		explicit CoroutinesSystem( const TypeID & pTypeID, const SystemPhase pPhase = SystemPhase::UPDATE, const std::int32_t pPriority = 0 ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * CoroutinesSystem destructor. Destroys unfinished Tasks.
+		 *
+		 * @throws - no exceptions.
+		**/
+		virtual ~CoroutinesSystem( ) noexcept;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of started, not finished Tasks.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @throws - no exceptions.
+		**/
+		std::size_t getTasksCount( ) const noexcept;
+
+		/**
+		 * Enabled || Disable System. Disabled System doesn't resume Tasks.
+		 *
+		 * @thread_safety - atomic-flag used.
+		 * @param pEnabled - 'true' to Enable, 'false' to Disable.
+		 * @throws - no exceptions.
+		**/
+		virtual void setEnabled( const bool pEnabled ) noexcept override;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns awaitable, which resumes Task on the next frame.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		static NextFrame nextFrame( ) noexcept;
+
+		/**
+		 * Returns awaitable, which resumes Task after delay.
+		 *
+		 * @thread_safety - not required.
+		 * @param pSeconds - delay, in seconds of the System time.
+		 * @throws - no exceptions.
+		**/
+		static Delay delay( const float pSeconds ) noexcept;
+
+		/**
+		 * Returns awaitable, which resumes Task after Event is sent (see
+		 * EventsManager::sendEvent), & returns the Event.
+		 *
+		 * @thread_safety - not required.
+		 * @param pTypeID - Event Type-ID.
+		 * @throws - no exceptions.
+		**/
+		static WaitEvent waitEvent( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Start Task. Task is resumed on the next update.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread,
+		 * or before update (e.g. from Task).
+		 * @param pTask - Task.
+		 * @throws - no exceptions.
+		**/
+		void start( CoroutineTask pTask ) noexcept;
+
+		/**
+		 * Resume ready Tasks in one batch: Tasks of the previous frame, Tasks
+		 * with Events received & Tasks with elapsed delay.
+		 *
+		 * @thread_safety - called by SystemsManager.
+		 * @param pDeltaTime - elapsed time since previous update, in seconds.
+		 * @throws - no exceptions.
+		**/
+		virtual void update( const float pDeltaTime ) noexcept override;
+
+		/**
+		 * Components are not used.
+		 *
+		 * @thread_safety - not required.
+		 * @param pTypeID - Component Type-ID.
+		 * @param pComponent - Component.
+		 * @throws - no exceptions.
+		**/
+		virtual void addComponent( const TypeID & pTypeID, compoent_ptr & pComponent ) noexcept override;
+
+		/**
+		 * Components are not used.
+		 *
+		 * @thread_safety - not required.
+		 * @param pTypeID - Component Type-ID.
+		 * @param pID - Component ID.
+		 * @throws - no exceptions.
+		**/
+		virtual void removeComponent( const TypeID & pTypeID, const ObjectID & pID ) noexcept override;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::CoroutinesSystem
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_COROUTINES_SYSTEM_DECL
+#define MECS_COROUTINES_SYSTEM_DECL
+using mecs_CoroutinesSystem = mecs::CoroutinesSystem;
+#endif // !MECS_COROUTINES_SYSTEM_DECL
+
+#endif // COROUTINES
+
+// -----------------------------------------------------------
+
+#endif // !MECS_COROUTINES_SYSTEM_HPP
@@ -47,6 +47,9 @@
 #include "../components/Component.hpp"
 #endif // !MECS_COMPONENT_HPP
 
+// Include C++ algorithm
+#include <algorithm>
+
 // ===========================================================
 // mecs::System
 // ===========================================================
@@ -64,16 +67,36 @@ namespace mecs
 	 * System constructor.
 	 *
 	 * @param pTypeID - System Type-ID.
+	 * @param pPhase - update phase.
+	 * @param pPriority - update priority in the phase, lower is updated first.
 	 * @throws - no exceptions.
 	**/
-	System::System( const TypeID & pTypeID ) noexcept
+	System::System( const TypeID & pTypeID, const SystemPhase pPhase, const std::int32_t pPriority ) noexcept
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		: mMutex( ),
 		mEnabled( false ),
 #else // ONE-THREAD
 		: mEnabled( false ),
 #endif // MULTI-THREADING
-		mTypeID( pTypeID )
+		mReads( ),
+		mWrites( ),
+		mAccessed( ),
+		mOwnChanges( ),
+		mEvents( ),
+		mRunConditions( RUN_ALWAYS ),
+		mLastRun( 0 ),
+		mInterval( 1 ),
+		mTicks( 0 ),
+		mStaggered( false ),
+		mSkippedTime( 0.0f ),
+		mBudget( duration_t::zero( ) ),
+		mDeadline( ),
+#ifdef MECS_LIB_PROFILING // PROFILING
+		mStats( ),
+#endif // PROFILING
+		mTypeID( pTypeID ),
+		mPhase( pPhase ),
+		mPriority( pPriority )
 	{
 	}
 
@@ -101,6 +124,265 @@ namespace mecs
 	bool System::isEnabled( ) const noexcept
 	{ return( mEnabled ? true : false ); }
 
+	/**
+	 * Returns Components types, read by this System.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	const mecs_types_set & System::getReads( ) const noexcept
+	{ return( mReads ); }
+
+	/**
+	 * Returns Components types, written by this System.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	const mecs_types_set & System::getWrites( ) const noexcept
+	{ return( mWrites ); }
+
+	/**
+	 * Returns 'true' if this System didn't declare Components access,
+	 * & can't be updated in parallel with other Systems.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	bool System::isExclusive( ) const noexcept
+	{ return( mReads.none( ) && mWrites.none( ) ); }
+
+	/**
+	 * Returns 'true' if this System & other System can't be updated in parallel:
+	 * one writes Components type, which other reads or writes.
+	 *
+	 * @thread_safety - not required.
+	 * @param pOther - other System.
+	 * @throws - no exceptions.
+	**/
+	bool System::conflictsWith( const System & pOther ) const noexcept
+	{
+
+		// Exclusive Systems conflict with any System.
+		if ( isExclusive( ) || pOther.isExclusive( ) )
+			return( true );
+
+		// Write-Read & Write-Write conflicts.
+		return( ( mWrites & ( pOther.mReads | pOther.mWrites ) ).any( ) || ( pOther.mWrites & mReads ).any( ) );
+
+	}
+
+	/**
+	 * Returns 'true' if System has nothing to process. 'false' by default.
+	 *
+	 * @thread_safety - called by SystemsManager before update.
+	 * @throws - no exceptions.
+	**/
+	bool System::isEmpty( ) const noexcept
+	{ return( false ); }
+
+	/**
+	 * Returns run conditions.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	std::uint8_t System::getRunConditions( ) const noexcept
+	{ return( mRunConditions ); }
+
+	/**
+	 * Returns update interval in ticks.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t System::getInterval( ) const noexcept
+	{ return( mInterval ); }
+
+	/**
+	 * Returns update time budget, zero if unlimited.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	System::duration_t System::getTimeBudget( ) const noexcept
+	{ return( mBudget ); }
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+	/**
+	 * Returns update time statistics.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @throws - no exceptions.
+	**/
+	const SystemStats & System::getStats( ) const noexcept
+	{ return( mStats ); }
+#endif // PROFILING
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Declare read access to Components type.
+	 * Call before System added to SystemsManager (e.g. in constructor).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pTypeID - Component Type-ID.
+	 * @throws - no exceptions.
+	**/
+	void System::readComponent( const TypeID & pTypeID ) noexcept
+	{
+
+		// Accessed types
+		if ( !mReads.test( pTypeID ) && !mWrites.test( pTypeID ) )
+		{
+			mAccessed.push_back( pTypeID );
+			mOwnChanges.push_back( 0 );
+		}
+
+		// Read access
+		mReads.set( pTypeID );
+
+	}
+
+	/**
+	 * Declare write (read-write) access to Components type.
+	 * Call before System added to SystemsManager (e.g. in constructor).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pTypeID - Component Type-ID.
+	 * @throws - no exceptions.
+	**/
+	void System::writeComponent( const TypeID & pTypeID ) noexcept
+	{
+
+		// Accessed types
+		if ( !mReads.test( pTypeID ) && !mWrites.test( pTypeID ) )
+		{
+			mAccessed.push_back( pTypeID );
+			mOwnChanges.push_back( 0 );
+		}
+
+		// Write access
+		mWrites.set( pTypeID );
+
+	}
+
+	/**
+	 * Update System every N ticks, instead of each tick.
+	 * Call before System added to SystemsManager (e.g. in constructor).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pTicks - update interval in ticks, 1 to update every tick.
+	 * @throws - no exceptions.
+	**/
+	void System::runEvery( const std::uint32_t pTicks ) noexcept
+	{ mInterval = pTicks > 0 ? pTicks : 1; }
+
+	/**
+	 * Set update time budget.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pBudget - time budget per update, zero if unlimited.
+	 * @throws - no exceptions.
+	**/
+	void System::setTimeBudget( const duration_t pBudget ) noexcept
+	{ mBudget = pBudget; }
+
+	/**
+	 * Returns 'true' if update time budget isn't spent yet.
+	 *
+	 * @thread_safety - call from update.
+	 * @throws - no exceptions.
+	**/
+	bool System::hasTimeLeft( ) const noexcept
+	{ return( mBudget == duration_t::zero( ) || std::chrono::steady_clock::now( ) < mDeadline ); }
+
+	/**
+	 * Set run conditions, to skip update when System has nothing to process.
+	 * Call before System added to SystemsManager (e.g. in constructor).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pConditions - RUN_ALWAYS, or combination of RUN_IF_* flags.
+	 * @throws - no exceptions.
+	**/
+	void System::runIf( const std::uint8_t pConditions ) noexcept
+	{ mRunConditions = pConditions; }
+
+	/**
+	 * Declare Events type, which triggers update (see RUN_IF_EVENTS).
+	 * Call before System added to SystemsManager (e.g. in constructor).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pTypeID - Event Type-ID.
+	 * @throws - no exceptions.
+	**/
+	void System::listenEvent( const TypeID & pTypeID ) noexcept
+	{
+
+		// Cancel, if already listened.
+		if ( std::find( mEvents.cbegin( ), mEvents.cend( ), pTypeID ) != mEvents.cend( ) )
+			return;
+
+		// Add Events type.
+		mEvents.push_back( pTypeID );
+
+	}
+
+	/**
+	 * Update System. Called by SystemsManager::update, if System is enabled.
+	 * Does nothing by default.
+	 *
+	 * @thread_safety - called from any worker thread, but never in parallel
+	 * with conflicting Systems.
+	 * @param pDeltaTime - elapsed time since previous update, in seconds.
+	 * @throws - no exceptions.
+	**/
+	void System::update( const float pDeltaTime ) noexcept
+	{
+		// Unused.
+		( void )pDeltaTime;
+	}
+
+	/**
+	 * Add batch of Components of the same type.
+	 * By default forwards each Component to addComponent.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTypeID - Components Type-ID.
+	 * @param pComponents - Components.
+	 * @param pCount - number of Components.
+	 * @throws - no exceptions.
+	**/
+	void System::addComponents( const TypeID & pTypeID, compoent_ptr * const pComponents, const std::size_t pCount ) noexcept
+	{
+
+		// Add Components
+		for ( std::size_t i = 0; i < pCount; i++ )
+			addComponent( pTypeID, pComponents[i] );
+
+	}
+
+	/**
+	 * Remove batch of Components of the same type.
+	 * By default forwards each ID to removeComponent.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pTypeID - Components Type-ID.
+	 * @param pIDs - Components IDs.
+	 * @param pCount - number of IDs.
+	 * @throws - no exceptions.
+	**/
+	void System::removeComponents( const TypeID & pTypeID, const ObjectID * const pIDs, const std::size_t pCount ) noexcept
+	{
+
+		// Remove Components
+		for ( std::size_t i = 0; i < pCount; i++ )
+			removeComponent( pTypeID, pIDs[i] );
+
+	}
+
 	// -----------------------------------------------------------
 
 } // mecs
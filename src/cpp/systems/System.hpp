@@ -45,6 +45,13 @@
 #include "../cfg/ecs_types.hpp"
 #endif // !MECS_TYPES_HPP
 
+#ifdef MECS_LIB_PROFILING // PROFILING
+// Include mecs::SystemStats
+#ifndef MECS_SYSTEM_STATS_HPP
+#include "SystemStats.hpp"
+#endif // !MECS_SYSTEM_STATS_HPP
+#endif // PROFILING
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -54,6 +61,31 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
+	// ===========================================================
+	// mecs::SystemPhase
+	// ===========================================================
+
+	/** System update phase. Phases are updated in declaration order. **/
+	enum class SystemPhase : std::uint8_t
+	{
+
+		/** Input, Commands playback & other preparations. **/
+		PRE_UPDATE = 0,
+
+		/** Game logic. **/
+		UPDATE = 1,
+
+		/** Physics, Animation & other logic, depending on game logic. **/
+		POST_UPDATE = 2,
+
+		/** Synchronization with Render. **/
+		RENDER_SYNC = 3,
+
+		/** Number of phases. **/
+		COUNT = 4
+
+	}; // mecs::SystemPhase
+
 	// ===========================================================
 	// mecs::System
 	// ===========================================================
@@ -61,6 +93,18 @@ namespace mecs
 	/**
 	 * System - system handles logic, using Components as data-providers, & Events
 	 * for communication with Entities & other Systems (Physics & Render).
+	 * 
+	 * (?) Systems of the same phase, accessing different Components types (see
+	 * readComponent & writeComponent), are updated in parallel. System without
+	 * declared access is updated exclusively.
+	 * 
+	 * (?) Systems, which don't need each tick, are updated every N ticks (see
+	 * runEvery), or process part of their Entities per tick within time budget
+	 * (see setTimeBudget & hasTimeLeft).
+	 * 
+	 * (?) Systems with run conditions (see runIf) are skipped, when they have
+	 * nothing to process: no Components, no changes, or no Events. Time of
+	 * such ticks isn't added to delta-time of the next update.
 	 *
 	 * @authors Denis Z. (code4un@yandex.ru)
 	 * @version 1.0
@@ -80,6 +124,12 @@ namespace mecs
 		/** Type-alias for Component. **/
 		using compoent_ptr = mecs_shared<Component>;
 
+		/** Type-alias for time duration. **/
+		using duration_t = std::chrono::steady_clock::duration;
+
+		/** Type-alias for time point. **/
+		using time_point_t = std::chrono::steady_clock::time_point;
+
 		// ===========================================================
 		// FIELDS
 		// ===========================================================
@@ -95,6 +145,56 @@ namespace mecs
 		bool mEnabled;
 #endif // MULTI-THREADING
 
+		/** Components types, read by this System. **/
+		mecs_types_set mReads;
+
+		/** Components types, written by this System. **/
+		mecs_types_set mWrites;
+
+		/** Components types, read or written by this System. **/
+		mecs_vector<TypeID> mAccessed;
+
+		/** Change versions, set by the last update of this System, by index of mAccessed (0, if none). **/
+		mecs_vector<std::uint64_t> mOwnChanges;
+
+		/** Events types, listened by this System (see RUN_IF_EVENTS). **/
+		mecs_vector<TypeID> mEvents;
+
+		/** Run conditions (see runIf). **/
+		std::uint8_t mRunConditions;
+
+		/** Components change version at the start of the last update (see SystemsManager::setChanged). **/
+		std::uint64_t mLastRun;
+
+		/** Update interval in ticks, 1 to update every tick. **/
+		std::uint32_t mInterval;
+
+		/** Ticks counter. SystemsManager staggers it, to spread rate-divided Systems across ticks. **/
+		std::uint64_t mTicks;
+
+		/** 'true' if SystemsManager already staggered this System. **/
+		bool mStaggered;
+
+		/** Time of ticks skipped by rate-divider, added to delta-time of the next update. **/
+		float mSkippedTime;
+
+		/** Update time budget, zero if unlimited. **/
+		duration_t mBudget;
+
+		/** End of current update time budget. **/
+		time_point_t mDeadline;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		/** Update time statistics, collected by SystemsManager. **/
+		SystemStats mStats;
+#endif // PROFILING
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class SystemsManager;
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -103,9 +203,91 @@ namespace mecs
 		 * System constructor.
 		 *
 		 * @param pTypeID - System Type-ID.
+		 * @param pPhase - update phase.
+		 * @param pPriority - update priority in the phase, lower is updated first.
+		 * @throws - no exceptions.
+		**/
+		explicit System( const TypeID & pTypeID, const SystemPhase pPhase = SystemPhase::UPDATE, const std::int32_t pPriority = 0 ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Declare read access to Components type.
+		 * Call before System added to SystemsManager (e.g. in constructor).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTypeID - Component Type-ID.
+		 * @throws - no exceptions.
+		**/
+		void readComponent( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Declare write (read-write) access to Components type.
+		 * Call before System added to SystemsManager (e.g. in constructor).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTypeID - Component Type-ID.
+		 * @throws - no exceptions.
+		**/
+		void writeComponent( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Update System every N ticks, instead of each tick.
+		 * SystemsManager staggers Systems with the same interval across ticks,
+		 * & passes time of skipped ticks with the next update.
+		 * Call before System added to SystemsManager (e.g. in constructor).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTicks - update interval in ticks, 1 to update every tick.
+		 * @throws - no exceptions.
+		**/
+		void runEvery( const std::uint32_t pTicks ) noexcept;
+
+		/**
+		 * Set update time budget, for Systems, which process part of their
+		 * Entities each tick & resume from the same place on the next tick
+		 * (see hasTimeLeft).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pBudget - time budget per update, zero if unlimited.
+		 * @throws - no exceptions.
+		**/
+		void setTimeBudget( const duration_t pBudget ) noexcept;
+
+		/**
+		 * Returns 'true' if update time budget isn't spent yet.
+		 * Always 'true' without time budget.
+		 *
+		 * @thread_safety - call from update.
+		 * @throws - no exceptions.
+		**/
+		bool hasTimeLeft( ) const noexcept;
+
+		/**
+		 * Set run conditions, to skip update when System has nothing to process.
+		 * Call before System added to SystemsManager (e.g. in constructor).
+		 *
+		 * (?) RUN_IF_NOT_EMPTY is required, if set. RUN_IF_CHANGED &
+		 * RUN_IF_EVENTS are triggers: System is updated, if any of set
+		 * triggers fired.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pConditions - RUN_ALWAYS, or combination of RUN_IF_* flags.
+		 * @throws - no exceptions.
+		**/
+		void runIf( const std::uint8_t pConditions ) noexcept;
+
+		/**
+		 * Declare Events type, which triggers update (see RUN_IF_EVENTS).
+		 * Call before System added to SystemsManager (e.g. in constructor).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTypeID - Event Type-ID.
 		 * @throws - no exceptions.
 		**/
-		explicit System( const TypeID & pTypeID ) noexcept;
+		void listenEvent( const TypeID & pTypeID ) noexcept;
 
 		// ===========================================================
 		// DELETED
@@ -129,6 +311,24 @@ namespace mecs
 		/** Type-ID. **/
 		const TypeID mTypeID;
 
+		/** Update phase. **/
+		const SystemPhase mPhase;
+
+		/** Update priority in the phase, lower is updated first. **/
+		const std::int32_t mPriority;
+
+		/** Run condition: update each tick. **/
+		static constexpr const std::uint8_t RUN_ALWAYS = 0;
+
+		/** Run condition: skip, if System is empty (see isEmpty). **/
+		static constexpr const std::uint8_t RUN_IF_NOT_EMPTY = 1;
+
+		/** Run condition: update, if accessed Components types changed since the last update. **/
+		static constexpr const std::uint8_t RUN_IF_CHANGED = 2;
+
+		/** Run condition: update, if listened Events are queued in EventsManager. **/
+		static constexpr const std::uint8_t RUN_IF_EVENTS = 4;
+
 		// ===========================================================
 		// DESTRUCTOR
 		// ===========================================================
@@ -161,10 +361,99 @@ namespace mecs
 		**/
 		virtual void setEnabled( const bool pEnabled ) noexcept = 0;
 
+		/**
+		 * Returns Components types, read by this System.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		const mecs_types_set & getReads( ) const noexcept;
+
+		/**
+		 * Returns Components types, written by this System.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		const mecs_types_set & getWrites( ) const noexcept;
+
+		/**
+		 * Returns 'true' if this System didn't declare Components access,
+		 * & can't be updated in parallel with other Systems.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		bool isExclusive( ) const noexcept;
+
+		/**
+		 * Returns 'true' if this System & other System can't be updated in parallel:
+		 * one writes Components type, which other reads or writes.
+		 *
+		 * @thread_safety - not required.
+		 * @param pOther - other System.
+		 * @throws - no exceptions.
+		**/
+		bool conflictsWith( const System & pOther ) const noexcept;
+
+		/**
+		 * Returns 'true' if System has nothing to process (see RUN_IF_NOT_EMPTY).
+		 * Must be O(1), e.g. size of internal Components array. 'false' by default.
+		 *
+		 * @thread_safety - called by SystemsManager before update.
+		 * @throws - no exceptions.
+		**/
+		virtual bool isEmpty( ) const noexcept;
+
+		/**
+		 * Returns run conditions.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		std::uint8_t getRunConditions( ) const noexcept;
+
+		/**
+		 * Returns update interval in ticks.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		std::uint32_t getInterval( ) const noexcept;
+
+		/**
+		 * Returns update time budget, zero if unlimited.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		duration_t getTimeBudget( ) const noexcept;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		/**
+		 * Returns update time statistics.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @throws - no exceptions.
+		**/
+		const SystemStats & getStats( ) const noexcept;
+#endif // PROFILING
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
 
+		/**
+		 * Update System. Called by SystemsManager::update, if System is enabled.
+		 * Does nothing by default.
+		 *
+		 * @thread_safety - called from any worker thread, but never in parallel
+		 * with conflicting Systems.
+		 * @param pDeltaTime - elapsed time since previous update, in seconds.
+		 * @throws - no exceptions.
+		**/
+		virtual void update( const float pDeltaTime ) noexcept;
+
 		/**
 		 * Add Component.
 		 * 
@@ -185,6 +474,32 @@ namespace mecs
 		**/
 		virtual void removeComponent( const TypeID & pTypeID, const ObjectID & pID ) noexcept = 0;
 
+		/**
+		 * Add batch of Components of the same type.
+		 * By default forwards each Component to addComponent. Override to lock
+		 * once & bulk-insert into internal arrays.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pTypeID - Components Type-ID.
+		 * @param pComponents - Components.
+		 * @param pCount - number of Components.
+		 * @throws - no exceptions.
+		**/
+		virtual void addComponents( const TypeID & pTypeID, compoent_ptr * const pComponents, const std::size_t pCount ) noexcept;
+
+		/**
+		 * Remove batch of Components of the same type.
+		 * By default forwards each ID to removeComponent. Override to lock
+		 * once & bulk-remove from internal arrays.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pTypeID - Components Type-ID.
+		 * @param pIDs - Components IDs.
+		 * @param pCount - number of IDs.
+		 * @throws - no exceptions.
+		**/
+		virtual void removeComponents( const TypeID & pTypeID, const ObjectID * const pIDs, const std::size_t pCount ) noexcept;
+
 		// -----------------------------------------------------------
 
 	}; // mecs::System
@@ -0,0 +1,353 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_SYSTEM_STATS_HPP
+#define MECS_SYSTEM_STATS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::SystemStats
+	// ===========================================================
+
+	/**
+	 * SystemStats - System update time statistics: count, total, min, max & latency
+	 * histogram with log-linear buckets (HDR-style, 8 sub-buckets per power of 2,
+	 * so percentiles are precise to 12.5%).
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class SystemStats final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for time duration. **/
+		using duration_t = std::chrono::nanoseconds;
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Number of bits of sub-bucket index. **/
+		static constexpr const std::uint32_t SUB_BITS = 3;
+
+		/** Number of sub-buckets per power of 2. **/
+		static constexpr const std::uint32_t SUB_COUNT = 1 << SUB_BITS;
+
+		/** Max tracked power of 2 (nanoseconds, ~39 hours), longer times are counted in the last bucket. **/
+		static constexpr const std::uint32_t MAX_POWER = 47;
+
+		/** Number of buckets. **/
+		static constexpr const std::uint32_t BUCKETS_COUNT = ( MAX_POWER - SUB_BITS + 2 ) * SUB_COUNT;
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Number of updates. **/
+		std::uint64_t mCount;
+
+		/** Total time, in nanoseconds. **/
+		std::int64_t mTotal;
+
+		/** Min time, in nanoseconds. **/
+		std::int64_t mMin;
+
+		/** Max time, in nanoseconds. **/
+		std::int64_t mMax;
+
+		/** Histogram buckets. **/
+		std::uint32_t mBuckets[BUCKETS_COUNT];
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Returns bucket index of the time.
+		 *
+		 * @param pTime - time, in nanoseconds.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t getBucket( const std::uint64_t pTime ) noexcept
+		{
+
+			// Exact buckets for small times.
+			if ( pTime < SUB_COUNT )
+				return( static_cast<std::uint32_t>( pTime ) );
+
+			// Highest bit (power of 2).
+			std::uint32_t power_( 0 );
+			for ( std::uint32_t shift_ = 32; shift_ > 0; shift_ >>= 1 )
+			{
+				if ( ( pTime >> ( power_ + shift_ ) ) != 0 )
+					power_ += shift_;
+			}
+
+			// Last bucket for too long times.
+			if ( power_ > MAX_POWER )
+				return( BUCKETS_COUNT - 1 );
+
+			// Sub-bucket: next bits after the highest one.
+			const std::uint32_t sub_( static_cast<std::uint32_t>( pTime >> ( power_ - SUB_BITS ) ) & ( SUB_COUNT - 1 ) );
+
+			return( ( power_ - SUB_BITS + 1 ) * SUB_COUNT + sub_ );
+
+		}
+
+		/**
+		 * Returns the lowest time of the bucket.
+		 *
+		 * @param pBucket - bucket index.
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t getBucketTime( const std::uint32_t pBucket ) noexcept
+		{
+
+			// Exact buckets for small times.
+			if ( pBucket < SUB_COUNT )
+				return( pBucket );
+
+			// Power of 2 & sub-bucket.
+			const std::uint32_t power_( pBucket / SUB_COUNT + SUB_BITS - 1 );
+			const std::uint64_t sub_( pBucket % SUB_COUNT );
+
+			return( ( SUB_COUNT + sub_ ) << ( power_ - SUB_BITS ) );
+
+		}
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * SystemStats constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit SystemStats( ) noexcept
+			: mCount( 0 ),
+			mTotal( 0 ),
+			mMin( 0 ),
+			mMax( 0 ),
+			mBuckets( )
+		{
+		}
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of updates.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		std::uint64_t getCount( ) const noexcept
+		{ return( mCount ); }
+
+		/**
+		 * Returns total time.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		duration_t getTotal( ) const noexcept
+		{ return( duration_t( mTotal ) ); }
+
+		/**
+		 * Returns min time.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		duration_t getMin( ) const noexcept
+		{ return( duration_t( mMin ) ); }
+
+		/**
+		 * Returns max time.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		duration_t getMax( ) const noexcept
+		{ return( duration_t( mMax ) ); }
+
+		/**
+		 * Returns mean time.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		duration_t getMean( ) const noexcept
+		{ return( duration_t( mCount > 0 ? mTotal / static_cast<std::int64_t>( mCount ) : 0 ) ); }
+
+		/**
+		 * Returns percentile of time (precise to 12.5%).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pPercentile - percentile [0, 100].
+		 * @throws - no exceptions.
+		**/
+		duration_t getPercentile( const double pPercentile ) const noexcept
+		{
+
+			// Cancel
+			if ( mCount == 0 )
+				return( duration_t( 0 ) );
+
+			// Rank of the percentile.
+			const double rank_( pPercentile * 0.01 * static_cast<double>( mCount ) );
+
+			// Search bucket of the rank.
+			std::uint64_t count_( 0 );
+			for ( std::uint32_t bucket_ = 0; bucket_ < BUCKETS_COUNT; bucket_++ )
+			{
+
+				count_ += mBuckets[bucket_];
+
+				// Bucket found, clamp by min & max.
+				if ( static_cast<double>( count_ ) >= rank_ && mBuckets[bucket_] > 0 )
+					return( duration_t( std::max( mMin, std::min( static_cast<std::int64_t>( getBucketTime( bucket_ ) ), mMax ) ) ) );
+
+			}
+
+			return( duration_t( mMax ) );
+
+		}
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Add time.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTime - time.
+		 * @throws - no exceptions.
+		**/
+		void add( const duration_t pTime ) noexcept
+		{
+
+			// Time in nanoseconds.
+			const std::int64_t time_( pTime.count( ) > 0 ? pTime.count( ) : 0 );
+
+			// Min & Max
+			if ( mCount == 0 || time_ < mMin )
+				mMin = time_;
+			if ( time_ > mMax )
+				mMax = time_;
+
+			// Count & Total
+			mCount++;
+			mTotal += time_;
+
+			// Histogram
+			mBuckets[getBucket( static_cast<std::uint64_t>( time_ ) )]++;
+
+		}
+
+		/**
+		 * Reset statistics.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		void reset( ) noexcept
+		{ *this = SystemStats( ); }
+
+		// -----------------------------------------------------------
+
+	}; // mecs::SystemStats
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_SYSTEM_STATS_DECL
+#define MECS_SYSTEM_STATS_DECL
+using mecs_SystemStats = mecs::SystemStats;
+#endif // !MECS_SYSTEM_STATS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_SYSTEM_STATS_HPP
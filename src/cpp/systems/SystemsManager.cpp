@@ -42,10 +42,36 @@
 #include "SystemsManager.hpp"
 #endif // !MECS_SYSTEMS_MANAGER_HPP
 
-// Include mecs::System
-#ifndef MECS_SYSTEM_HPP
-#include "System.hpp"
-#endif // !MECS_SYSTEM_HPP
+// Include mecs::World
+#ifndef MECS_WORLD_HPP
+#include "../world/World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include mecs::ECSEngine
+#ifndef MECS_ECS_HPP
+#include "../ecs.hpp"
+#endif // !MECS_ECS_HPP
+
+// Include mecs::EventsManager
+#ifndef MECS_EVENTS_MANAGER_HPP
+#include "../events/EventsManager.hpp"
+#endif // !MECS_EVENTS_MANAGER_HPP
+
+// Include mecs::ThreadPool
+#ifndef MECS_THREAD_POOL_HPP
+#include "../utils/ThreadPool.hpp"
+#endif // !MECS_THREAD_POOL_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ cmath
+#include <cmath>
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+// Include C++ ostream
+#include <ostream>
+#endif // PROFILING
 
 // ===========================================================
 // mecs::SystemsManager
@@ -56,13 +82,6 @@ namespace mecs
 
 	// -----------------------------------------------------------
 
-	// ===========================================================
-	// FIELDS
-	// ===========================================================
-
-	/** SystemsManager instance. **/
-	SystemsManager * SystemsManager::mInstance( nullptr );
-
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -74,11 +93,54 @@ namespace mecs
 	**/
 	SystemsManager::SystemsManager( ) noexcept
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		: mMutex( ), mSystems( )
+		: mMutex( ),
 #else // ONE-THREAD
-		: mSystems( )
+		:
 #endif // MULTI-THREADING
+		mRegistry( nullptr ),
+		mRegistryOwner( std::make_shared<Registry>( ) ),
+		mOrderChanged( false ),
+		mOrder( ),
+		mPhasesOffsets( ),
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		mPhasesTime( ),
+		mFixedStep( DEFAULT_FIXED_STEP ),
+		mMaxSteps( DEFAULT_MAX_STEPS ),
+		mAccumulator( 0.0 ),
+		mAlpha( 0.0f ),
+		mVersion( 0 ),
+		mDependents( ),
+		mDependencies( ),
+		mPending( ),
+		mRemaining( 0 ),
+		mDeltaTime( 0.0f ),
+		mThreadsCount( std::thread::hardware_concurrency( ) > 1 ? std::thread::hardware_concurrency( ) - 1 : 0 ),
+#else // ONE-THREAD
+		mPhasesTime( ),
+		mFixedStep( DEFAULT_FIXED_STEP ),
+		mMaxSteps( DEFAULT_MAX_STEPS ),
+		mAccumulator( 0.0 ),
+		mAlpha( 0.0f ),
+		mVersion( 0 ),
+		mThreadsCount( 0 ),
+#endif // MULTI-THREADING
+#ifdef MECS_LIB_PROFILING // PROFILING
+		mThreadPool( nullptr ),
+		mStatsStream( nullptr ),
+		mStatsInterval( 0 ),
+		mStatsUpdates( 0 )
+#else // !PROFILING
+		mThreadPool( nullptr )
+#endif // PROFILING
 	{
+
+		// Publish empty Registry, so readers never see null.
+		mRegistry = mRegistryOwner.get( );
+
+		// Reset change versions.
+		for ( std::size_t typeID_ = 0; typeID_ < COMPONENTS_TYPES_COUNT; typeID_++ )
+			mChangeVersions[typeID_] = 0;
+
 	}
 
 	// ===========================================================
@@ -90,16 +152,41 @@ namespace mecs
 	 *
 	 * @throws - no exceptions.
 	**/
-	SystemsManager::~SystemsManager( ) noexcept = default;
+	SystemsManager::~SystemsManager( ) noexcept
+	{
+
+		// Delete worker threads.
+		delete mThreadPool;
+		mThreadPool = nullptr;
+
+	}
 
 	// ===========================================================
 	// GETTERS & SETTERS
 	// ===========================================================
 
 	/**
-	 * Search a System with the Type-ID.
+	 * Returns SystemsManager of the current World (see World::getCurrent).
 	 *
-	 * @thread_safety - thread-lock used.
+	 * @thread_safety - thread-local used.
+	 * @return - SystemsManager, or null.
+	 * @throws - no exceptions.
+	**/
+	SystemsManager * SystemsManager::getInstance( ) noexcept
+	{
+
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
+		// Return SystemsManager
+		return( world_ != nullptr ? world_->mSystemsManager : nullptr );
+
+	}
+
+	/**
+	 * Search a System with the Type-ID. Slow path: Guard & shared-pointer copy.
+	 *
+	 * @thread_safety - lock-free.
 	 * @param pTypeID - System Type-ID.
 	 * @return - System, or null.
 	 * @throws - no exceptions.
@@ -107,20 +194,175 @@ namespace mecs
 	SystemsManager::system_ptr_t SystemsManager::getSystem( const TypeID & pTypeID ) noexcept
 	{
 
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Keep Registry alive.
+		EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		// Lock
-		mecs_ulock lock_( mInstance->mMutex );
+		// Return System
+		return( instance_->mRegistry.load( std::memory_order_acquire )->mSystems[pTypeID] ); // Copy-construct
+#else // ONE-THREAD
+		// Return System
+		return( instance_->mRegistry->mSystems[pTypeID] ); // Copy-construct
 #endif // MULTI-THREADING
 
-		// Search System
-		auto systemPos_ = mInstance->mSystems.find( pTypeID );
+	}
 
-		// Cancel
-		if ( systemPos_ == mInstance->mSystems.cend( ) )
-			return( system_ptr_t( nullptr ) );
+	/**
+	 * Search a System with the Type-ID, without shared-pointer copy.
+	 *
+	 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+	 * @param pTypeID - System Type-ID.
+	 * @return - System, or null.
+	 * @throws - no exceptions.
+	**/
+	System * SystemsManager::findSystem( const TypeID & pTypeID ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
 
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Return System
+		return( instance_->mRegistry.load( std::memory_order_acquire )->mSystems[pTypeID].get( ) );
+#else // ONE-THREAD
 		// Return System
-		return( systemPos_->second ); // Copy-construct
+		return( instance_->mRegistry->mSystems[pTypeID].get( ) );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Returns time, spent by the phase during the last update (or tick, for all steps).
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pPhase - update phase.
+	 * @throws - no exceptions.
+	**/
+	SystemsManager::duration_t SystemsManager::getPhaseTime( const SystemPhase pPhase ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Return phase time
+		return( instance_->mPhasesTime[static_cast<std::size_t>( pPhase )] );
+
+	}
+
+	/**
+	 * Set fixed step of simulation (see tick).
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pFixedStep - fixed step, in seconds.
+	 * @param pMaxSteps - max number of steps per tick, to catch-up after slow frames.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::setFixedStep( const float pFixedStep, const std::uint32_t pMaxSteps ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Cancel
+		if ( pFixedStep <= 0.0f )
+			return;
+
+		// Set fixed step.
+		instance_->mFixedStep = pFixedStep;
+		instance_->mMaxSteps = pMaxSteps > 0 ? pMaxSteps : 1;
+
+	}
+
+	/**
+	 * Returns interpolation alpha [0, 1): part of fixed step, accumulated after
+	 * the last tick. Render blends previous & current states with it.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @throws - no exceptions.
+	**/
+	float SystemsManager::getAlpha( ) noexcept
+	{ return( getInstance( )->mAlpha ); }
+
+	/**
+	 * Set number of worker threads to update Systems in parallel.
+	 * By default, one less than number of hardware threads.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pThreads - number of worker threads, 0 to update Systems on the calling thread.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::setThreadsCount( const std::size_t pThreads ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Set number of worker threads.
+		instance_->mThreadsCount = pThreads;
+
+		// Delete worker threads, new will be created on demand.
+		delete instance_->mThreadPool;
+		instance_->mThreadPool = nullptr;
+#else // ONE-THREAD
+		( void )pThreads;
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Returns worker threads, shared by Systems scheduler & Systems (see
+	 * ThreadPool::parallelFor). Worker threads are bound to the current World.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread or Systems.
+	 * @throws - no exceptions.
+	**/
+	ThreadPool * SystemsManager::getThreadPool( ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Create worker threads.
+		if ( instance_->mThreadPool == nullptr )
+		{
+
+			// Current World, to bind to worker threads.
+			World * const world_( World::getCurrent( ) );
+
+			// Create ThreadPool
+			instance_->mThreadPool = new ThreadPool( instance_->mThreadsCount, [world_]( ) { World::setCurrent( world_ ); } );
+
+		}
+
+		return( instance_->mThreadPool );
+
+	}
+
+	/**
+	 * Returns Components change version of the type.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @param pTypeID - Components Type-ID.
+	 * @return - version of the last change, 0 if never changed.
+	 * @throws - no exceptions.
+	**/
+	std::uint64_t SystemsManager::getChangeVersion( const TypeID & pTypeID ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Return version
+		return( instance_->mChangeVersions[pTypeID].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Return version
+		return( instance_->mChangeVersions[pTypeID] );
+#endif // MULTI-THREADING
 
 	}
 
@@ -128,6 +370,182 @@ namespace mecs
 	// METHODS
 	// ===========================================================
 
+	/**
+	 * Publish new Registry, & retire previous one.
+	 *
+	 * @thread_safety - called by writers under thread-lock.
+	 * @param pRegistry - new Registry (update order is built here).
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::publish( registry_ptr_t pRegistry ) noexcept
+	{
+
+		// Update order: Systems by Type-ID.
+		pRegistry->mOrder.clear( );
+		for ( std::size_t typeID_ = 0; typeID_ < SYSTEMS_COUNT; typeID_++ )
+		{
+			if ( pRegistry->mSystems[typeID_] != nullptr )
+				pRegistry->mOrder.push_back( pRegistry->mSystems[typeID_] );
+		}
+
+		// Sort by phase & priority. Stable sort keeps Type-ID order.
+		std::stable_sort( pRegistry->mOrder.begin( ), pRegistry->mOrder.end( ),
+			[]( const system_ptr_t & pA, const system_ptr_t & pB )
+			{
+				if ( pA->mPhase != pB->mPhase )
+					return( pA->mPhase < pB->mPhase );
+				return( pA->mPriority < pB->mPriority );
+			} );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Publish Registry
+		mRegistry.store( pRegistry.get( ), std::memory_order_release );
+#else // ONE-THREAD
+		// Publish Registry
+		mRegistry = pRegistry.get( );
+#endif // MULTI-THREADING
+
+		// Swap Registry owner.
+		mRegistryOwner.swap( pRegistry );
+
+		// Retire previous Registry, readers may still use it.
+		ECSEngine::retire( std::move( pRegistry ) );
+
+		// Rebuild update order on the next update.
+		mOrderChanged = true;
+
+	}
+
+	/**
+	 * Rebuild Systems update order, if Systems added or removed.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::updateOrder( ) noexcept
+	{
+
+		// Cancel
+		if ( !mOrderChanged )
+			return;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( mMutex );
+#endif // MULTI-THREADING
+
+		// Reset flag before copying, so changes made after copying are not lost.
+		mOrderChanged = false;
+
+		// Copy sorted Systems, keeping them alive until the next rebuild.
+		mOrder = mRegistryOwner->mOrder;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Unlock
+		lock_.unlock( );
+#endif // MULTI-THREADING
+
+		// Phases offsets
+		std::size_t index_( 0 );
+		for ( std::size_t phase_ = 0; phase_ < PHASES_COUNT; phase_++ )
+		{
+
+			// First System of the phase.
+			mPhasesOffsets[phase_] = index_;
+
+			// Skip Systems of the phase.
+			while ( index_ < mOrder.size( ) && static_cast<std::size_t>( mOrder[index_]->mPhase ) == phase_ )
+				index_++;
+
+		}
+
+		// End of the last phase.
+		mPhasesOffsets[PHASES_COUNT] = index_;
+
+		// Ticks load of rate-divided Systems: interval -> Systems count per tick.
+		mecs_map<std::uint32_t, mecs_vector<std::size_t>> loads_;
+
+		// Count already staggered Systems.
+		for ( const system_ptr_t & system_sp : mOrder )
+		{
+			if ( system_sp->mInterval > 1 && system_sp->mStaggered )
+			{
+				mecs_vector<std::size_t> & load_ = loads_[system_sp->mInterval];
+				load_.resize( system_sp->mInterval, 0 );
+				load_[system_sp->mTicks % system_sp->mInterval]++;
+			}
+		}
+
+		// Stagger new Systems: start at the least loaded tick.
+		for ( const system_ptr_t & system_sp : mOrder )
+		{
+			if ( system_sp->mInterval > 1 && !system_sp->mStaggered )
+			{
+				mecs_vector<std::size_t> & load_ = loads_[system_sp->mInterval];
+				load_.resize( system_sp->mInterval, 0 );
+				const std::size_t tick_( static_cast<std::size_t>( std::min_element( load_.cbegin( ), load_.cend( ) ) - load_.cbegin( ) ) );
+				load_[tick_]++;
+				system_sp->mTicks = tick_;
+				system_sp->mStaggered = true;
+			}
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Reset dependencies
+		mDependents.assign( mOrder.size( ), mecs_vector<std::size_t>( ) );
+		mDependencies.assign( mOrder.size( ), 0 );
+		mPending.reset( new mecs_atomic<std::size_t>[mOrder.size( )] );
+
+		// Build dependencies graph of each phase.
+		for ( std::size_t phase_ = 0; phase_ < PHASES_COUNT; phase_++ )
+		{
+			for ( std::size_t index_ = mPhasesOffsets[phase_]; index_ < mPhasesOffsets[phase_ + 1]; index_++ )
+			{
+				for ( std::size_t previous_ = mPhasesOffsets[phase_]; previous_ < index_; previous_++ )
+				{
+
+					// System depends on previous conflicting System.
+					if ( mOrder[index_]->conflictsWith( *mOrder[previous_] ) )
+					{
+						mDependents[previous_].push_back( index_ );
+						mDependencies[index_]++;
+					}
+
+				}
+			}
+		}
+#endif // MULTI-THREADING
+
+	}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	/**
+	 * Update System & submit dependent Systems, which are ready.
+	 *
+	 * @thread_safety - called by worker threads.
+	 * @param pIndex - System index in update order.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::updateSystem( const std::size_t pIndex ) noexcept
+	{
+
+		// Update System
+		runSystem( *mOrder[pIndex], mDeltaTime );
+
+		// Submit dependent Systems, which have no more dependencies.
+		for ( const std::size_t dependent_ : mDependents[pIndex] )
+		{
+			if ( mPending[dependent_].fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+				mThreadPool->submit( [this, dependent_]( ) { updateSystem( dependent_ ); } );
+		}
+
+		// Done
+		mRemaining.fetch_sub( 1, std::memory_order_release );
+
+	}
+#endif // MULTI-THREADING
+
+
 	/**
 	 * Initialize SystemsManager.
 	 *
@@ -137,12 +555,15 @@ namespace mecs
 	void SystemsManager::Initialize( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance != nullptr )
+		if ( world_ == nullptr || world_->mSystemsManager != nullptr )
 			return;
 
 		// Create SystemsManager instance.
-		mInstance = new SystemsManager( );
+		world_->mSystemsManager = new SystemsManager( );
 
 	}
 
@@ -155,13 +576,16 @@ namespace mecs
 	void SystemsManager::Terminate( ) noexcept
 	{
 
+		// Current World.
+		World * const world_( World::getCurrent( ) );
+
 		// Cancel
-		if ( mInstance == nullptr )
+		if ( world_ == nullptr || world_->mSystemsManager == nullptr )
 			return;
 
 		// Delete SystemsManager instance.
-		delete mInstance;
-		mInstance = nullptr;
+		delete world_->mSystemsManager;
+		world_->mSystemsManager = nullptr;
 
 	}
 
@@ -175,13 +599,26 @@ namespace mecs
 	void SystemsManager::addSystem( system_ptr_t & pSystem ) noexcept
 	{
 
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mMutex );
+		mecs_ulock lock_( instance_->mMutex );
 #endif // MULTI-THREADING
 
+		// Cancel, if System with the same Type-ID already added.
+		if ( instance_->mRegistryOwner->mSystems[pSystem->mTypeID] != nullptr )
+			return;
+
+		// Copy Registry
+		registry_ptr_t registry_( std::make_shared<Registry>( *instance_->mRegistryOwner ) );
+
 		// Add System
-		mInstance->mSystems.insert( std::pair<const TypeID, system_ptr_t>( pSystem->mTypeID, pSystem ) );
+		registry_->mSystems[pSystem->mTypeID] = pSystem;
+
+		// Publish Registry
+		instance_->publish( std::move( registry_ ) );
 
 	}
 
@@ -195,22 +632,590 @@ namespace mecs
 	void SystemsManager::removeSystem( const TypeID & pTypeID ) noexcept
 	{
 
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
 		// Lock
-		mecs_ulock lock_( mInstance->mMutex );
+		mecs_ulock lock_( instance_->mMutex );
 #endif // MULTI-THREADING
 
-		// Search System
-		auto systemPos_ = mInstance->mSystems.find( pTypeID );
-
 		// Cancel
-		if ( systemPos_ == mInstance->mSystems.cend( ) )
+		if ( instance_->mRegistryOwner->mSystems[pTypeID] == nullptr )
 			return;
 
+		// Copy Registry
+		registry_ptr_t registry_( std::make_shared<Registry>( *instance_->mRegistryOwner ) );
+
 		// Remove System
-		mInstance->mSystems.erase( systemPos_ );
+		registry_->mSystems[pTypeID].reset( );
+
+		// Publish Registry
+		instance_->publish( std::move( registry_ ) );
+
+	}
+
+	/**
+	 * Route batch of Components to Systems, which read or write their type.
+	 *
+	 * @thread_safety - lock-free, Systems lock themselves.
+	 * @param pTypeID - Components Type-ID.
+	 * @param pComponents - Components.
+	 * @param pCount - number of Components.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::addComponents( const TypeID & pTypeID, component_ptr_t * const pComponents, const std::size_t pCount ) noexcept
+	{
+
+		// Cancel
+		if ( pCount < 1 )
+			return;
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Keep Registry alive.
+		EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Registry
+		Registry * const registry_( instance_->mRegistry.load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Registry
+		Registry * const registry_( instance_->mRegistry );
+#endif // MULTI-THREADING
+
+		// Deliver batch to each System, accessing Components type.
+		for ( const system_ptr_t & system_sp : registry_->mOrder )
+		{
+			if ( system_sp->mReads.test( pTypeID ) || system_sp->mWrites.test( pTypeID ) )
+				system_sp->addComponents( pTypeID, pComponents, pCount );
+		}
+
+		// Components type changed.
+		instance_->setChanged( pTypeID );
+
+	}
+
+	/**
+	 * Route batch of removed Components IDs to Systems, which read or write their type.
+	 *
+	 * @thread_safety - lock-free, Systems lock themselves.
+	 * @param pTypeID - Components Type-ID.
+	 * @param pIDs - Components IDs.
+	 * @param pCount - number of IDs.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::removeComponents( const TypeID & pTypeID, const ObjectID * const pIDs, const std::size_t pCount ) noexcept
+	{
+
+		// Cancel
+		if ( pCount < 1 )
+			return;
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Keep Registry alive.
+		EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Registry
+		Registry * const registry_( instance_->mRegistry.load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Registry
+		Registry * const registry_( instance_->mRegistry );
+#endif // MULTI-THREADING
+
+		// Deliver batch to each System, accessing Components type.
+		for ( const system_ptr_t & system_sp : registry_->mOrder )
+		{
+			if ( system_sp->mReads.test( pTypeID ) || system_sp->mWrites.test( pTypeID ) )
+				system_sp->removeComponents( pTypeID, pIDs, pCount );
+		}
+
+		// Components type changed.
+		instance_->setChanged( pTypeID );
+
+	}
+
+	/**
+	 * Mark Components type changed, so Systems with RUN_IF_CHANGED, accessing
+	 * this type, are updated.
+	 *
+	 * @thread_safety - lock-free, atomic used.
+	 * @param pTypeID - Components Type-ID.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::markChanged( const TypeID & pTypeID ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Mark changed
+		instance_->setChanged( pTypeID );
+
+	}
+
+	/**
+	 * Mark Components type changed.
+	 *
+	 * @thread_safety - atomic used.
+	 * @param pTypeID - Components Type-ID.
+	 * @return - change version.
+	 * @throws - no exceptions.
+	**/
+	std::uint64_t SystemsManager::setChanged( const TypeID & pTypeID ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// New version
+		const std::uint64_t version_( mVersion.fetch_add( 1, std::memory_order_acq_rel ) + 1 );
+
+		// Set version of the type, unless newer one already set.
+		std::uint64_t previous_( mChangeVersions[pTypeID].load( std::memory_order_relaxed ) );
+		while ( previous_ < version_ && !mChangeVersions[pTypeID].compare_exchange_weak( previous_, version_, std::memory_order_release, std::memory_order_relaxed ) );
+
+		// Return version
+		return( version_ );
+#else // ONE-THREAD
+		// Set version of the type.
+		mChangeVersions[pTypeID] = ++mVersion;
+
+		// Return version
+		return( mVersion );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Check System run conditions with change versions & pending Events counters.
+	 *
+	 * @thread_safety - called by worker threads.
+	 * @param pSystem - System.
+	 * @return - 'true' if System has something to process.
+	 * @throws - no exceptions.
+	**/
+	bool SystemsManager::shouldRun( const System & pSystem ) const noexcept
+	{
+
+		// Run conditions
+		const std::uint8_t conditions_( pSystem.mRunConditions );
+
+		// Always
+		if ( conditions_ == System::RUN_ALWAYS )
+			return( true );
+
+		// Required: not empty.
+		if ( ( conditions_ & System::RUN_IF_NOT_EMPTY ) != 0 && pSystem.isEmpty( ) )
+			return( false );
+
+		// Run, if no triggers set.
+		if ( ( conditions_ & ( System::RUN_IF_CHANGED | System::RUN_IF_EVENTS ) ) == 0 )
+			return( true );
+
+		// Trigger: accessed Components changed.
+		if ( ( conditions_ & System::RUN_IF_CHANGED ) != 0 )
+		{
+			for ( std::size_t i = 0; i < pSystem.mAccessed.size( ); i++ )
+			{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+				const std::uint64_t version_( mChangeVersions[pSystem.mAccessed[i]].load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+				const std::uint64_t version_( mChangeVersions[pSystem.mAccessed[i]] );
+#endif // MULTI-THREADING
+
+				// Changed since the last update, not by the System itself.
+				if ( version_ > pSystem.mLastRun && version_ != pSystem.mOwnChanges[i] )
+					return( true );
+			}
+		}
+
+		// Trigger: listened Events queued.
+		if ( ( conditions_ & System::RUN_IF_EVENTS ) != 0 )
+		{
+			for ( const TypeID typeID_ : pSystem.mEvents )
+			{
+				if ( EventsManager::getPendingCount( typeID_ ) > 0 )
+					return( true );
+			}
+		}
+
+		// Nothing to process.
+		return( false );
+
+	}
+
+	/**
+	 * Update System, if enabled & its run conditions are met. Written
+	 * Components types are marked changed after update. With profiling,
+	 * adds update time to System statistics.
+	 *
+	 * @thread_safety - called by worker threads.
+	 * @param pSystem - System.
+	 * @param pDeltaTime - elapsed time since previous update, in seconds.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::runSystem( System & pSystem, const float pDeltaTime ) noexcept
+	{
+
+		// Count tick, even if disabled, so staggering is kept.
+		const std::uint64_t tick_( pSystem.mTicks++ );
+
+		// Cancel
+		if ( !pSystem.isEnabled( ) )
+			return;
+
+		// Skip tick of rate-divided System, keeping its time for the next update.
+		if ( pSystem.mInterval > 1 && tick_ % pSystem.mInterval != 0 )
+		{
+			pSystem.mSkippedTime += pDeltaTime;
+			return;
+		}
+
+		// Skip System with nothing to process, dropping skipped time, so idle System isn't updated with huge delta-time.
+		if ( !shouldRun( pSystem ) )
+		{
+			pSystem.mSkippedTime = 0.0f;
+			return;
+		}
+
+		// Delta-time, with time of skipped ticks.
+		const float deltaTime_( pDeltaTime + pSystem.mSkippedTime );
+		pSystem.mSkippedTime = 0.0f;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		// Update start time.
+		const auto start_( std::chrono::steady_clock::now( ) );
+#endif // PROFILING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Changes version before update, changes made during update are newer.
+		const std::uint64_t startVersion_( mVersion.load( std::memory_order_acquire ) );
+#else // ONE-THREAD
+		// Changes version before update.
+		const std::uint64_t startVersion_( mVersion );
+#endif // MULTI-THREADING
+
+		// Time budget, clock is read only for budgeted Systems.
+		if ( pSystem.mBudget != System::duration_t::zero( ) )
+		{
+#ifdef MECS_LIB_PROFILING // PROFILING
+			pSystem.mDeadline = start_ + pSystem.mBudget;
+#else // !PROFILING
+			pSystem.mDeadline = std::chrono::steady_clock::now( ) + pSystem.mBudget;
+#endif // PROFILING
+		}
+
+		// Update System
+		pSystem.update( deltaTime_ );
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		// Add update time.
+		pSystem.mStats.add( std::chrono::duration_cast<SystemStats::duration_t>( std::chrono::steady_clock::now( ) - start_ ) );
+#endif // PROFILING
+
+		// Written Components types changed.
+		for ( std::size_t i = 0; i < pSystem.mAccessed.size( ); i++ )
+		{
+
+			// Components Type-ID
+			const TypeID typeID_( pSystem.mAccessed[i] );
+
+			// Skip read-only type.
+			if ( !pSystem.mWrites.test( typeID_ ) )
+				continue;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Type changed by others during update.
+			const bool changed_( mChangeVersions[typeID_].load( std::memory_order_acquire ) > startVersion_ );
+#else // ONE-THREAD
+			// Type changed by others during update.
+			const bool changed_( mChangeVersions[typeID_] > startVersion_ );
+#endif // MULTI-THREADING
+
+			// Mark changed, & skip own change next time, unless it hides others change.
+			const std::uint64_t version_( setChanged( typeID_ ) );
+			pSystem.mOwnChanges[i] = changed_ ? 0 : version_;
+
+		}
+
+		// Changes before update are processed, changes made during update trigger next one.
+		pSystem.mLastRun = startVersion_;
+
+	}
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+	/**
+	 * Count update, & dump statistics, if interval passed.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::countStatsUpdate( ) noexcept
+	{
+
+		// Cancel
+		if ( mStatsStream == nullptr || ++mStatsUpdates < mStatsInterval )
+			return;
+
+		// Reset counter
+		mStatsUpdates = 0;
+
+		// Dump & reset statistics.
+		dumpStats( *mStatsStream );
+		resetStats( );
+
+	}
+#endif // PROFILING
+
+	/**
+	 * Update enabled Systems of the phase.
+	 *
+	 * @thread_safety - not thread-safe, call from one (main) thread.
+	 * @param pPhase - phase index.
+	 * @param pDeltaTime - elapsed time since previous update, in seconds.
+	 * @return - time, spent by the phase.
+	 * @throws - no exceptions.
+	**/
+	SystemsManager::duration_t SystemsManager::updatePhase( const std::size_t pPhase, const float pDeltaTime ) noexcept
+	{
+
+		// Phase start time.
+		const auto start_( std::chrono::steady_clock::now( ) );
+
+		// Phase Systems range.
+		const std::size_t begin_( mPhasesOffsets[pPhase] );
+		const std::size_t end_( mPhasesOffsets[pPhase + 1] );
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Update Systems in parallel.
+		if ( end_ - begin_ > 1 && mThreadsCount > 0 )
+		{
+
+			// Worker threads, bound to the current World.
+			ThreadPool * const threadPool_( getThreadPool( ) );
+
+			// Delta time for worker threads.
+			mDeltaTime = pDeltaTime;
+
+			// Reset remaining dependencies.
+			mRemaining.store( end_ - begin_, std::memory_order_relaxed );
+			for ( std::size_t index_ = begin_; index_ < end_; index_++ )
+				mPending[index_].store( mDependencies[index_], std::memory_order_relaxed );
+
+			// Submit Systems without dependencies.
+			for ( std::size_t index_ = begin_; index_ < end_; index_++ )
+			{
+				if ( mDependencies[index_] == 0 )
+					threadPool_->submit( [this, index_]( ) { updateSystem( index_ ); } );
+			}
+
+			// Barrier: help worker threads, until all Systems of the phase updated.
+			while ( mRemaining.load( std::memory_order_acquire ) > 0 )
+			{
+				if ( !threadPool_->runPending( ) )
+					std::this_thread::yield( );
+			}
+
+			// Phase time.
+			return( std::chrono::steady_clock::now( ) - start_ );
+
+		}
+#endif // MULTI-THREADING
+
+		// Update Systems of the phase.
+		for ( std::size_t index_ = begin_; index_ < end_; index_++ )
+		{
+
+			// Update System
+			runSystem( *mOrder[index_], pDeltaTime );
+
+		}
+
+		// Phase time.
+		return( std::chrono::steady_clock::now( ) - start_ );
+
+	}
+
+	/**
+	 * Update enabled Systems, phase by phase.
+	 *
+	 * @thread_safety - not thread-safe, call from one (main) thread.
+	 * @param pDeltaTime - elapsed time since previous update, in seconds.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::update( const float pDeltaTime ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Rebuild update order
+		instance_->updateOrder( );
+
+		// Update phases, with Guard: Systems (& worker threads) may use borrowed pointers.
+		{
+			EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+			for ( std::size_t phase_ = 0; phase_ < PHASES_COUNT; phase_++ )
+				instance_->mPhasesTime[phase_] = instance_->updatePhase( phase_, pDeltaTime );
+		}
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		// Periodic statistics dump.
+		instance_->countStatsUpdate( );
+#endif // PROFILING
+
+		// Sync-point: reclaim retired Entities, Components & snapshots.
+		ECSEngine::reclaim( );
+
+	}
+
+	/**
+	 * Advance simulation by frame time with fixed steps.
+	 *
+	 * @thread_safety - not thread-safe, call from one (main) thread.
+	 * @param pFrameTime - elapsed (render) frame time, in seconds.
+	 * @return - number of fixed steps executed.
+	 * @throws - no exceptions.
+	**/
+	std::uint32_t SystemsManager::tick( const float pFrameTime ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Rebuild update order once for all steps.
+		instance_->updateOrder( );
+
+		// Accumulate frame time.
+		instance_->mAccumulator += pFrameTime > 0.0f ? pFrameTime : 0.0f;
+
+		// Number of fixed steps.
+		const double step_( instance_->mFixedStep );
+		std::uint32_t steps_( static_cast<std::uint32_t>( std::min( instance_->mAccumulator / step_, static_cast<double>( instance_->mMaxSteps ) + 1.0 ) ) );
+
+		// Catch-up cap: drop backlog, which can't be simulated in time.
+		if ( steps_ > instance_->mMaxSteps )
+		{
+			steps_ = instance_->mMaxSteps;
+			instance_->mAccumulator = std::fmod( instance_->mAccumulator, step_ ) + step_ * steps_;
+		}
+
+		// Consume steps time.
+		instance_->mAccumulator -= step_ * steps_;
+
+		// Reset simulation phases time.
+		const std::size_t renderPhase_( static_cast<std::size_t>( SystemPhase::RENDER_SYNC ) );
+		for ( std::size_t phase_ = 0; phase_ < renderPhase_; phase_++ )
+			instance_->mPhasesTime[phase_] = duration_t::zero( );
+
+		// Update phases, with Guard: Systems (& worker threads) may use borrowed pointers.
+		{
+			EpochReclaimer::Guard guard_( World::getCurrent( )->getReclaimer( ) );
+
+			// Fixed steps of simulation phases.
+			for ( std::uint32_t i = 0; i < steps_; i++ )
+			{
+				for ( std::size_t phase_ = 0; phase_ < renderPhase_; phase_++ )
+					instance_->mPhasesTime[phase_] += instance_->updatePhase( phase_, instance_->mFixedStep );
+			}
+
+			// Interpolation alpha between previous & current simulation states.
+			instance_->mAlpha = static_cast<float>( instance_->mAccumulator / step_ );
+
+			// Render synchronization, once per frame.
+			instance_->mPhasesTime[renderPhase_] = instance_->updatePhase( renderPhase_, pFrameTime );
+		}
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		// Periodic statistics dump.
+		instance_->countStatsUpdate( );
+#endif // PROFILING
+
+		// Sync-point: reclaim retired Entities, Components & snapshots.
+		ECSEngine::reclaim( );
+
+		return( steps_ );
+
+	}
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+	/**
+	 * Reset update time statistics of all Systems (see System::getStats).
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::resetStats( ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Reset statistics
+		for ( system_ptr_t & system_lr : instance_->mOrder )
+			system_lr->mStats.reset( );
+
+	}
+
+	/**
+	 * Print update time statistics of all Systems, in update order.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pStream - output stream.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::dumpStats( std::ostream & pStream ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Print statistics, in microseconds.
+		for ( system_ptr_t & system_lr : instance_->mOrder )
+		{
+
+			// Statistics
+			const SystemStats & stats_( system_lr->mStats );
+
+			// Print
+			pStream << "System " << static_cast<std::uint32_t>( system_lr->mTypeID )
+				<< ": count " << stats_.getCount( )
+				<< ", total " << stats_.getTotal( ).count( ) / 1000.0 << " us"
+				<< ", mean " << stats_.getMean( ).count( ) / 1000.0 << " us"
+				<< ", min " << stats_.getMin( ).count( ) / 1000.0 << " us"
+				<< ", max " << stats_.getMax( ).count( ) / 1000.0 << " us"
+				<< ", p50 " << stats_.getPercentile( 50.0 ).count( ) / 1000.0 << " us"
+				<< ", p90 " << stats_.getPercentile( 90.0 ).count( ) / 1000.0 << " us"
+				<< ", p99 " << stats_.getPercentile( 99.0 ).count( ) / 1000.0 << " us\n";
+
+		}
+
+	}
+
+	/**
+	 * Dump & reset statistics periodically, after update or tick.
+	 *
+	 * @thread_safety - not thread-safe, call from the updating thread.
+	 * @param pStream - output stream, or null to disable periodic dump.
+	 * @param pInterval - number of updates (or ticks) between dumps.
+	 * @throws - no exceptions.
+	**/
+	void SystemsManager::setStatsDump( std::ostream * const pStream, const std::uint32_t pInterval ) noexcept
+	{
+
+		// SystemsManager of the current World.
+		SystemsManager * const instance_( getInstance( ) );
+
+		// Set periodic dump.
+		instance_->mStatsStream = pStream;
+		instance_->mStatsInterval = pInterval;
+		instance_->mStatsUpdates = 0;
 
 	}
+#endif // PROFILING
 
 	// -----------------------------------------------------------
 
@@ -45,6 +45,16 @@
 #include "../cfg/ecs_types.hpp"
 #endif // !MECS_TYPES_HPP
 
+// Include mecs::System
+#ifndef MECS_SYSTEM_HPP
+#include "System.hpp"
+#endif // !MECS_SYSTEM_HPP
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+// Include C++ iosfwd
+#include <iosfwd>
+#endif // PROFILING
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -59,7 +69,17 @@ namespace mecs
 	// ===========================================================
 
 	/**
-	 * SystemsManager - handles Systems cache.
+	 * SystemsManager - handles Systems cache & updates Systems by phases.
+	 * 
+	 * (?) Systems are stored in immutable Registry snapshot: flat array indexed by
+	 * Type-ID & update order (phase, priority, Type-ID). Readers access snapshot
+	 * lock-free, add & remove publish new snapshot (copy-on-write), old snapshot
+	 * is retired via EpochReclaimer of the World.
+	 * 
+	 * (?) With multi-threading, each phase is a dependencies graph: System depends
+	 * on previous Systems of the phase, which access the same Components types
+	 * (see System::conflictsWith). Independent Systems are updated in parallel
+	 * by worker threads, phases are separated by barriers.
 	 *
 	 * @authors Denis Z. (code4un@yandex.ru)
 	 * @version 1.0
@@ -79,23 +99,149 @@ namespace mecs
 		/** Type-alias for System pointer. **/
 		using system_ptr_t = mecs::mecs_shared<System>;
 
-		/** Type-alias for Systems map. **/
-		using systems_map_t = mecs_map<const TypeID, system_ptr_t>;
+		/** Type-alias for Component pointer. **/
+		using component_ptr_t = mecs::mecs_shared<Component>;
+
+		/** Type-alias for Systems update order. **/
+		using systems_order_t = mecs_vector<system_ptr_t>;
+
+		/** Type-alias for time duration. **/
+		using duration_t = std::chrono::steady_clock::duration;
 
 		// ===========================================================
-		// FIELDS
+		// CONSTANTS
+		// ===========================================================
+
+		/** Number of update phases. **/
+		static constexpr std::size_t PHASES_COUNT = static_cast<std::size_t>( SystemPhase::COUNT );
+
+		/** Default fixed step of simulation, in seconds (60 Hz). **/
+		static constexpr float DEFAULT_FIXED_STEP = 1.0f / 60.0f;
+
+		/** Default max number of fixed steps per tick. **/
+		static constexpr std::uint32_t DEFAULT_MAX_STEPS = 5;
+
+		/** Number of Systems Type-IDs. **/
+		static constexpr std::size_t SYSTEMS_COUNT = static_cast<std::size_t>( std::numeric_limits<TypeID>::max( ) ) + 1;
+
+		/** Number of Components types. **/
+		static constexpr std::size_t COMPONENTS_TYPES_COUNT = static_cast<std::size_t>( std::numeric_limits<TypeID>::max( ) ) + 1;
+
 		// ===========================================================
+		// mecs::SystemsManager::Registry
+		// ===========================================================
+
+		/**
+		 * Registry - immutable snapshot of Systems.
+		**/
+		struct Registry final
+		{
+
+			/** Systems, indexed by Type-ID. **/
+			system_ptr_t mSystems[SYSTEMS_COUNT];
+
+			/** Systems in update order (phase, priority, Type-ID). **/
+			systems_order_t mOrder;
 
-		/** SystemsManager instance. **/
-		static SystemsManager * mInstance;
+		}; // mecs::SystemsManager::Registry
+
+		/** Type-alias for Registry pointer. **/
+		using registry_ptr_t = mecs_shared<Registry>;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
 
 #ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
-		/** Mutex. **/
+		/** Mutex of writers (add & remove). **/
 		mecs_mutex mMutex;
+
+		/** Current Registry, read lock-free. **/
+		mecs_atomic<Registry*> mRegistry;
+#else // ONE-THREAD
+		/** Current Registry. **/
+		Registry * mRegistry;
 #endif // MULTI-THREADING
 
-		/** Systems. **/
-		systems_map_t mSystems;
+		/** Current Registry owner, accessed by writers. **/
+		registry_ptr_t mRegistryOwner;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Update order changed flag. **/
+		mecs_abool mOrderChanged;
+#else // ONE-THREAD
+		/** Update order changed flag. **/
+		bool mOrderChanged;
+#endif // MULTI-THREADING
+
+		/** Systems in update order. Accessed only by the updating thread. **/
+		systems_order_t mOrder;
+
+		/** First System index of each phase in update order, & end of the last phase. **/
+		std::size_t mPhasesOffsets[PHASES_COUNT + 1];
+
+		/** Time, spent by each phase during the last update. **/
+		duration_t mPhasesTime[PHASES_COUNT];
+
+		/** Fixed step of simulation, in seconds. **/
+		float mFixedStep;
+
+		/** Max number of fixed steps per tick. **/
+		std::uint32_t mMaxSteps;
+
+		/** Accumulated time, not simulated yet. **/
+		double mAccumulator;
+
+		/** Interpolation alpha after the last tick. **/
+		float mAlpha;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Components change version, increased by each change. **/
+		mecs_atomic<std::uint64_t> mVersion;
+
+		/** Version of the last change of each Components type. **/
+		mecs_atomic<std::uint64_t> mChangeVersions[COMPONENTS_TYPES_COUNT];
+#else // ONE-THREAD
+		/** Components change version, increased by each change. **/
+		std::uint64_t mVersion;
+
+		/** Version of the last change of each Components type. **/
+		std::uint64_t mChangeVersions[COMPONENTS_TYPES_COUNT];
+#endif // MULTI-THREADING
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Dependent Systems (indices in update order) of each System. **/
+		mecs_vector<mecs_vector<std::size_t>> mDependents;
+
+		/** Number of dependencies of each System. **/
+		mecs_vector<std::size_t> mDependencies;
+
+		/** Remaining dependencies of each System during update. **/
+		std::unique_ptr<mecs_atomic<std::size_t>[]> mPending;
+
+		/** Number of Systems, not updated yet in the current phase. **/
+		mecs_atomic<std::size_t> mRemaining;
+
+		/** Delta time of the current update. **/
+		float mDeltaTime;
+#endif // MULTI-THREADING
+
+		/** Number of worker threads. **/
+		std::size_t mThreadsCount;
+
+		/** Worker threads, created on demand. **/
+		ThreadPool * mThreadPool;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		/** Stream for periodic statistics dump, or null. **/
+		std::ostream * mStatsStream;
+
+		/** Number of updates between statistics dumps. **/
+		std::uint32_t mStatsInterval;
+
+		/** Number of updates since the last statistics dump. **/
+		std::uint32_t mStatsUpdates;
+#endif // PROFILING
 
 		// ===========================================================
 		// CONSTRUCTOR
@@ -108,6 +254,103 @@ namespace mecs
 		**/
 		explicit SystemsManager( ) noexcept;
 
+		/**
+		 * Returns SystemsManager of the current World (see World::getCurrent).
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - SystemsManager, or null.
+		 * @throws - no exceptions.
+		**/
+		static SystemsManager * getInstance( ) noexcept;
+
+		/**
+		 * Publish new Registry, & retire previous one.
+		 *
+		 * @thread_safety - called by writers under thread-lock.
+		 * @param pRegistry - new Registry (update order is built here).
+		 * @throws - no exceptions.
+		**/
+		void publish( registry_ptr_t pRegistry ) noexcept;
+
+		/**
+		 * Rebuild Systems update order, if Systems added or removed.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		void updateOrder( ) noexcept;
+
+		/**
+		 * Mark Components type changed.
+		 *
+		 * @thread_safety - atomic used.
+		 * @param pTypeID - Components Type-ID.
+		 * @return - change version.
+		 * @throws - no exceptions.
+		**/
+		std::uint64_t setChanged( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Check System run conditions (see System::runIf) with change versions
+		 * & pending Events counters.
+		 *
+		 * @thread_safety - called by worker threads.
+		 * @param pSystem - System.
+		 * @return - 'true' if System has something to process.
+		 * @throws - no exceptions.
+		**/
+		bool shouldRun( const System & pSystem ) const noexcept;
+
+		/**
+		 * Update System, if enabled & its run conditions are met. Written
+		 * Components types are marked changed after update. With profiling,
+		 * adds update time to System statistics.
+		 *
+		 * @thread_safety - called by worker threads.
+		 * @param pSystem - System.
+		 * @param pDeltaTime - elapsed time since previous update, in seconds.
+		 * @throws - no exceptions.
+		**/
+		void runSystem( System & pSystem, const float pDeltaTime ) noexcept;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		/**
+		 * Count update, & dump statistics, if interval passed.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @throws - no exceptions.
+		**/
+		void countStatsUpdate( ) noexcept;
+#endif // PROFILING
+
+		/**
+		 * Update enabled Systems of the phase.
+		 *
+		 * @thread_safety - not thread-safe, call from one (main) thread.
+		 * @param pPhase - phase index.
+		 * @param pDeltaTime - elapsed time since previous update, in seconds.
+		 * @return - time, spent by the phase.
+		 * @throws - no exceptions.
+		**/
+		duration_t updatePhase( const std::size_t pPhase, const float pDeltaTime ) noexcept;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * Update System & submit dependent Systems, which are ready.
+		 *
+		 * @thread_safety - called by worker threads.
+		 * @param pIndex - System index in update order.
+		 * @throws - no exceptions.
+		**/
+		void updateSystem( const std::size_t pIndex ) noexcept;
+#endif // MULTI-THREADING
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class World;
+
 		// ===========================================================
 		// DELETED
 		// ===========================================================
@@ -146,15 +389,93 @@ namespace mecs
 		// ===========================================================
 
 		/**
-		 * Search a System with the Type-ID.
+		 * Search a System with the Type-ID. Slow path: enters EpochReclaimer::Guard
+		 * & copies shared-pointer, so it can be called from any thread, &
+		 * returned System stays valid outside of Guard.
+		 * Prefer findSystem in hot paths.
 		 *
-		 * @thread_safety - thread-lock used.
+		 * @thread_safety - lock-free.
 		 * @param pTypeID - System Type-ID.
 		 * @return - System, or null.
 		 * @throws - no exceptions.
 		**/
 		static system_ptr_t getSystem( const TypeID & pTypeID ) noexcept;
 
+		/**
+		 * Search a System with the Type-ID, without shared-pointer copy.
+		 * 
+		 * (!) Borrowed pointer: valid inside System::update (update & tick
+		 * run Systems inside EpochReclaimer::Guard), or inside Guard of the
+		 * World (see ECSEngine::getReclaimer), because removed System is
+		 * destroyed only by ECSEngine::reclaim.
+		 *
+		 * @thread_safety - lock-free, call under EpochReclaimer::Guard.
+		 * @param pTypeID - System Type-ID.
+		 * @return - System, or null.
+		 * @throws - no exceptions.
+		**/
+		static System * findSystem( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Returns time, spent by the phase during the last update (or tick, for all steps).
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @param pPhase - update phase.
+		 * @throws - no exceptions.
+		**/
+		static duration_t getPhaseTime( const SystemPhase pPhase ) noexcept;
+
+		/**
+		 * Set fixed step of simulation (see tick).
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @param pFixedStep - fixed step, in seconds.
+		 * @param pMaxSteps - max number of steps per tick, to catch-up after slow frames.
+		 * @throws - no exceptions.
+		**/
+		static void setFixedStep( const float pFixedStep, const std::uint32_t pMaxSteps = DEFAULT_MAX_STEPS ) noexcept;
+
+		/**
+		 * Returns interpolation alpha [0, 1): part of fixed step, accumulated after
+		 * the last tick. Render blends previous & current states with it.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @throws - no exceptions.
+		**/
+		static float getAlpha( ) noexcept;
+
+		/**
+		 * Set number of worker threads to update Systems in parallel.
+		 * By default, one less than number of hardware threads.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @param pThreads - number of worker threads, 0 to update Systems on the calling thread.
+		 * @throws - no exceptions.
+		**/
+		static void setThreadsCount( const std::size_t pThreads ) noexcept;
+
+		/**
+		 * Returns worker threads, shared by Systems scheduler & Systems (see
+		 * ThreadPool::parallelFor). Worker threads are bound to the current World.
+		 * 
+		 * (?) Without worker threads (or multi-threading), jobs are executed by
+		 * the calling thread.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread or Systems.
+		 * @throws - no exceptions.
+		**/
+		static ThreadPool * getThreadPool( ) noexcept;
+
+		/**
+		 * Returns Components change version of the type (see markChanged).
+		 *
+		 * @thread_safety - lock-free, atomic used.
+		 * @param pTypeID - Components Type-ID.
+		 * @return - version of the last change, 0 if never changed.
+		 * @throws - no exceptions.
+		**/
+		static std::uint64_t getChangeVersion( const TypeID & pTypeID ) noexcept;
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -193,6 +514,106 @@ namespace mecs
 		**/
 		static void removeSystem( const TypeID & pTypeID ) noexcept;
 
+		/**
+		 * Route batch of Components to Systems, which read or write their type
+		 * (see System::readComponent & System::writeComponent). Each System
+		 * receives whole batch with one System::addComponents call.
+		 *
+		 * @thread_safety - lock-free, Systems lock themselves.
+		 * @param pTypeID - Components Type-ID.
+		 * @param pComponents - Components.
+		 * @param pCount - number of Components.
+		 * @throws - no exceptions.
+		**/
+		static void addComponents( const TypeID & pTypeID, component_ptr_t * const pComponents, const std::size_t pCount ) noexcept;
+
+		/**
+		 * Route batch of removed Components IDs to Systems, which read or write
+		 * their type. Each System receives whole batch with one
+		 * System::removeComponents call.
+		 *
+		 * @thread_safety - lock-free, Systems lock themselves.
+		 * @param pTypeID - Components Type-ID.
+		 * @param pIDs - Components IDs.
+		 * @param pCount - number of IDs.
+		 * @throws - no exceptions.
+		**/
+		static void removeComponents( const TypeID & pTypeID, const ObjectID * const pIDs, const std::size_t pCount ) noexcept;
+
+		/**
+		 * Mark Components type changed, so Systems with RUN_IF_CHANGED, accessing
+		 * this type, are updated. Types, written by updated Systems, & types of
+		 * added or removed Components (see addComponents) are marked automatically.
+		 *
+		 * @thread_safety - lock-free, atomic used. Changes, made during update of
+		 * the System, accessing the type, may be missed by it.
+		 * @param pTypeID - Components Type-ID.
+		 * @throws - no exceptions.
+		**/
+		static void markChanged( const TypeID & pTypeID ) noexcept;
+
+		/**
+		 * Update enabled Systems, phase by phase.
+		 * 
+		 * (?) Systems added or removed from other threads are applied on the next update.
+		 * 
+		 * (?) Systems are updated inside EpochReclaimer::Guard, so they can use
+		 * borrowed pointers (see findSystem). Sync-point: retired objects are
+		 * reclaimed after update (see ECSEngine::reclaim).
+		 *
+		 * @thread_safety - not thread-safe, call from one (main) thread.
+		 * @param pDeltaTime - elapsed time since previous update, in seconds.
+		 * @throws - no exceptions.
+		**/
+		static void update( const float pDeltaTime ) noexcept;
+
+		/**
+		 * Advance simulation by frame time with fixed steps: accumulates frame time,
+		 * & updates simulation phases (all, except RENDER_SYNC) once per each fixed
+		 * step, then RENDER_SYNC once with frame time (see getAlpha).
+		 * 
+		 * (?) Update order is rebuilt once for all steps. Backlog, exceeding max
+		 * steps, is dropped, so slow frames can't cause a spiral of death.
+		 * 
+		 * (?) Systems are updated inside EpochReclaimer::Guard. Sync-point:
+		 * retired objects are reclaimed after all steps (see ECSEngine::reclaim).
+		 *
+		 * @thread_safety - not thread-safe, call from one (main) thread.
+		 * @param pFrameTime - elapsed (render) frame time, in seconds.
+		 * @return - number of fixed steps executed.
+		 * @throws - no exceptions.
+		**/
+		static std::uint32_t tick( const float pFrameTime ) noexcept;
+
+#ifdef MECS_LIB_PROFILING // PROFILING
+		/**
+		 * Reset update time statistics of all Systems (see System::getStats).
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @throws - no exceptions.
+		**/
+		static void resetStats( ) noexcept;
+
+		/**
+		 * Print update time statistics of all Systems, in update order.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @param pStream - output stream.
+		 * @throws - no exceptions.
+		**/
+		static void dumpStats( std::ostream & pStream ) noexcept;
+
+		/**
+		 * Dump & reset statistics periodically, after update or tick.
+		 *
+		 * @thread_safety - not thread-safe, call from the updating thread.
+		 * @param pStream - output stream, or null to disable periodic dump.
+		 * @param pInterval - number of updates (or ticks) between dumps.
+		 * @throws - no exceptions.
+		**/
+		static void setStatsDump( std::ostream * const pStream, const std::uint32_t pInterval ) noexcept;
+#endif // PROFILING
+
 		// -----------------------------------------------------------
 
 	}; // mecs::SystemsManager
@@ -34,6 +34,86 @@
 // HEADER
 #include "main.hpp"
 
+/**
+ * ExampleComponent - Component with grid-cell position.
+**/
+struct ExampleComponent final : public mecs::Component
+{
+
+	/** Grid-cell position. **/
+	std::uint32_t mX, mY, mZ;
+
+	/**
+	 * ExampleComponent constructor.
+	 *
+	 * @param pX - X.
+	 * @param pY - Y.
+	 * @param pZ - Z.
+	 * @throws - no exceptions.
+	**/
+	explicit ExampleComponent( const std::uint32_t pX, const std::uint32_t pY, const std::uint32_t pZ ) noexcept
+		: mecs::Component( 0 ),
+		mX( pX ),
+		mY( pY ),
+		mZ( pZ )
+	{
+	}
+
+};
+
+/**
+ * Print positions of Components, in iteration order.
+ *
+ * @param pStorage - ComponentsStorage.
+ * @throws - no exceptions.
+**/
+static void printComponents( mecs::ComponentsStorage<ExampleComponent> & pStorage ) noexcept
+{
+
+	for ( std::size_t i = 0; i < pStorage.size( ); i++ )
+		std::cout << "(" << pStorage[i].mX << "," << pStorage[i].mY << ") ";
+
+	std::cout << std::endl;
+
+}
+
+/**
+ * Sort Components by Morton-code: stable sort, then incremental sort across frames.
+ *
+ * @throws - no exceptions.
+**/
+static void sortComponents( ) noexcept
+{
+
+	// Components, in reverse spatial order.
+	mecs::ComponentsStorage<ExampleComponent> storage_;
+	for ( std::uint32_t i = 0; i < 8; i++ )
+		storage_.add( std::make_shared<ExampleComponent>( 7 - i, i % 2, 0 ) );
+
+	// Sort-key: Morton-code of position.
+	const auto key_ = []( const ExampleComponent & pComponent ) -> std::uint64_t
+	{ return( mecs::mortonCode( pComponent.mX, pComponent.mY, pComponent.mZ ) ); };
+
+	// Stable sort.
+	storage_.sort( key_ );
+	std::cout << "Sorted: ";
+	printComponents( storage_ );
+
+	// Move Components.
+	for ( std::size_t i = 0; i < storage_.size( ); i++ )
+		storage_[i].mX = 7 - storage_[i].mX;
+
+	// Incremental sort, few moves per frame.
+	storage_.beginSort( key_ );
+	std::size_t frames_( 1 );
+	while ( !storage_.sortStep( 4 ) )
+		frames_++;
+
+	std::cout << "Sorted incrementally in " << frames_ << " frames: ";
+	printComponents( storage_ );
+
+}
+
 int main( )
 {
 	
@@ -43,6 +123,9 @@ int main( )
 	// Initialize mecs
 	mecs::ECSEngine::Initialize( );
 	
+	// Sort Components
+	sortComponents( );
+	
 	// Wait input.
 	std::cin.get( );
 	
@@ -38,4 +38,7 @@
 #include <fstream> // ifstream
 
 // Include ecs.hpp
-#include "../ecs.hpp"
\ No newline at end of file
+#include "../ecs.hpp"
+
+// Include mecs::ComponentsStorage
+#include "../components/ComponentsStorage.hpp"
\ No newline at end of file
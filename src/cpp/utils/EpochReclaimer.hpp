@@ -0,0 +1,462 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_EPOCH_RECLAIMER_HPP
+#define MECS_EPOCH_RECLAIMER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::EpochReclaimer
+	// ===========================================================
+
+	/**
+	 * EpochReclaimer - epoch-based deferred reclamation. Readers enter an epoch
+	 * (no refcounting, no locks) & may use raw pointers until they leave it.
+	 * Retired objects (Entities, Components, snapshots) are destroyed only after
+	 * every reader, active at retire-time, has left.
+	 * 
+	 * (?) Objects are kept alive with type-erased shared-pointer, so destructors
+	 * (& IDs returning to IDMap) run at reclaim-time.
+	 * 
+	 * (?) When all reader slots are used, readers share counted overflow slot,
+	 * nothing is reclaimed while any of them is active.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class EpochReclaimer final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Max number of simultaneous readers. **/
+		static constexpr const std::size_t MAX_READERS = 64;
+
+		/** Reader slot is not used. **/
+		static constexpr const std::uint64_t INACTIVE_EPOCH = std::numeric_limits<std::uint64_t>::max( );
+
+		/** Overflow reader slot, used when all reader slots are active. **/
+		static constexpr const std::size_t OVERFLOW_SLOT = MAX_READERS;
+
+		// ===========================================================
+		// mecs::EpochReclaimer::Guard
+		// ===========================================================
+
+		/**
+		 * Guard - RAII epoch enter & leave.
+		**/
+		class Guard final
+		{
+
+		private:
+
+			/** EpochReclaimer. **/
+			EpochReclaimer & mReclaimer;
+
+			/** Reader slot. **/
+			const std::size_t mSlot;
+
+			/* @deleted Guard const copy constructor */
+			Guard( const Guard & ) = delete;
+
+			/* @deleted Guard const copy assignment operator */
+			Guard & operator=( const Guard & ) = delete;
+
+		public:
+
+			/**
+			 * Guard constructor. Enters epoch.
+			 *
+			 * @param pReclaimer - EpochReclaimer.
+			 * @throws - no exceptions.
+			**/
+			explicit Guard( EpochReclaimer & pReclaimer ) noexcept
+				: mReclaimer( pReclaimer ),
+				mSlot( pReclaimer.enter( ) )
+			{
+			}
+
+			/**
+			 * Guard destructor. Leaves epoch.
+			 *
+			 * @throws - no exceptions.
+			**/
+			~Guard( ) noexcept
+			{ mReclaimer.leave( mSlot ); }
+
+		}; // mecs::EpochReclaimer::Guard
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/**
+		 * Retired - retired object & epoch.
+		**/
+		struct Retired
+		{
+
+			/** Epoch, when object was retired. **/
+			std::uint64_t mEpoch;
+
+			/** Object. **/
+			mecs_shared<void> mObject;
+
+		}; // mecs::EpochReclaimer::Retired
+
+		/** Type-alias for Retired objects queue. **/
+		using retired_queue_t = mecs_deque<Retired>;
+
+		/** Type-alias for Retired objects vector. **/
+		using retired_vector_t = mecs_vector<Retired>;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * ReaderSlot - reader epoch, aligned to cache-line to avoid false-sharing.
+		**/
+		struct alignas( 64 ) ReaderSlot
+		{
+
+			/** Epoch, or INACTIVE_EPOCH. **/
+			mecs_atomic<std::uint64_t> mEpoch;
+
+		}; // mecs::EpochReclaimer::ReaderSlot
+#endif // MULTI-THREADING
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** Global epoch. **/
+		mecs_atomic<std::uint64_t> mEpoch;
+
+		/** Readers. **/
+		ReaderSlot mReaders[MAX_READERS];
+
+		/** Number of readers in overflow slot. **/
+		mecs_atomic<std::size_t> mOverflowReaders;
+
+		/** Retired objects Mutex. **/
+		mecs_mutex mRetiredMutex;
+#else // ONE-THREAD
+		/** Global epoch. **/
+		std::uint64_t mEpoch;
+
+		/** Number of active readers. **/
+		std::size_t mReaders;
+#endif // MULTI-THREADING
+
+		/** Retired objects, ordered by epoch. **/
+		retired_queue_t mRetired;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted EpochReclaimer const copy constructor */
+		EpochReclaimer( const EpochReclaimer & ) = delete;
+
+		/* @deleted EpochReclaimer const copy assignment operator */
+		EpochReclaimer & operator=( const EpochReclaimer & ) = delete;
+
+		/* @deleted EpochReclaimer move constructor */
+		EpochReclaimer( EpochReclaimer && ) = delete;
+
+		/* @deleted EpochReclaimer move assignment operator */
+		EpochReclaimer & operator=( EpochReclaimer && ) = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * EpochReclaimer constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit EpochReclaimer( ) noexcept
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			: mEpoch( 0 ),
+			mOverflowReaders( 0 ),
+			mRetiredMutex( ),
+#else // ONE-THREAD
+			: mEpoch( 0 ),
+			mReaders( 0 ),
+#endif // MULTI-THREADING
+			mRetired( )
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Reset readers
+			for ( ReaderSlot & slot_lr : mReaders )
+				slot_lr.mEpoch.store( INACTIVE_EPOCH );
+#endif // MULTI-THREADING
+
+		}
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * EpochReclaimer destructor. Destroys all retired objects.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~EpochReclaimer( ) noexcept = default;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns current epoch.
+		 *
+		 * @thread_safety - atomic used.
+		 * @throws - no exceptions.
+		**/
+		std::uint64_t getEpoch( ) const noexcept
+		{ return( mEpoch ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Enter epoch. Objects, retired after this call, stay alive until leave( ).
+		 *
+		 * @thread_safety - lock-free.
+		 * @return - reader slot, required for leave( ).
+		 * @throws - no exceptions.
+		**/
+		std::size_t enter( ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Start search from thread-specific slot, to avoid contention.
+			std::size_t slot_( std::hash<mecs_thread_id>( )( std::this_thread::get_id( ) ) % MAX_READERS );
+
+			// Search free slot
+			for ( std::size_t attempt_ = 0; attempt_ < MAX_READERS; attempt_++ )
+			{
+
+				// Expected slot value.
+				std::uint64_t expected_( INACTIVE_EPOCH );
+
+				// Publish epoch
+				if ( mReaders[slot_].mEpoch.compare_exchange_strong( expected_, mEpoch.load( ) ) )
+					return( slot_ );
+
+				// Next slot
+				slot_ = ( slot_ + 1 ) % MAX_READERS;
+
+			}
+
+			// All slots used: count reader in overflow slot.
+			mOverflowReaders.fetch_add( 1 );
+
+			return( OVERFLOW_SLOT );
+#else // ONE-THREAD
+			// Increase readers counter.
+			mReaders++;
+
+			// Return slot
+			return( 0 );
+#endif // MULTI-THREADING
+
+		}
+
+		/**
+		 * Leave epoch.
+		 *
+		 * @thread_safety - lock-free.
+		 * @param pSlot - reader slot, returned by enter( ).
+		 * @throws - no exceptions.
+		**/
+		void leave( const std::size_t pSlot ) noexcept
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Release slot
+			if ( pSlot == OVERFLOW_SLOT )
+				mOverflowReaders.fetch_sub( 1 );
+			else
+				mReaders[pSlot].mEpoch.store( INACTIVE_EPOCH );
+#else // ONE-THREAD
+			// Decrease readers counter.
+			(void) pSlot;
+			mReaders--;
+#endif // MULTI-THREADING
+
+		}
+
+		/**
+		 * Retire object. Object is destroyed by reclaim( ), when no reader can access it.
+		 * 
+		 * (!) Object must be unreachable for new readers before retire.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pObject - Object.
+		 * @throws - no exceptions.
+		**/
+		void retire( mecs_shared<void> pObject ) noexcept
+		{
+
+			// Cancel
+			if ( pObject == nullptr )
+				return;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			// Lock
+			mecs_ulock lock_( mRetiredMutex );
+#endif // MULTI-THREADING
+
+			// Add Retired object.
+			mRetired.push_back( Retired{ mEpoch, std::move( pObject ) } );
+
+		}
+
+		/**
+		 * Destroy retired objects, that are not accessible by any reader,
+		 * & advance epoch. Called at sync-points.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @throws - no exceptions.
+		**/
+		void reclaim( ) noexcept
+		{
+
+			// Objects to destroy.
+			retired_vector_t reclaimed_;
+
+			{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+				// Lock
+				mecs_ulock lock_( mRetiredMutex );
+
+				// Current epoch.
+				const std::uint64_t epoch_( mEpoch.load( ) );
+
+				// Search oldest reader epoch, overflow readers epoch is unknown.
+				std::uint64_t minEpoch_( mOverflowReaders.load( ) > 0 ? 0 : epoch_ );
+				for ( ReaderSlot & slot_lr : mReaders )
+				{
+					const std::uint64_t readerEpoch_( slot_lr.mEpoch.load( ) );
+					if ( readerEpoch_ < minEpoch_ )
+						minEpoch_ = readerEpoch_;
+				}
+#else // ONE-THREAD
+				// Current epoch.
+				const std::uint64_t epoch_( mEpoch );
+
+				// Oldest reader epoch.
+				const std::uint64_t minEpoch_( mReaders > 0 ? 0 : epoch_ );
+#endif // MULTI-THREADING
+
+				// Collect objects, retired before any active reader entered.
+				while ( !mRetired.empty( ) && mRetired.front( ).mEpoch < minEpoch_ )
+				{
+					reclaimed_.push_back( std::move( mRetired.front( ) ) );
+					mRetired.pop_front( );
+				}
+
+				// Advance epoch
+				mEpoch = epoch_ + 1;
+
+			}
+
+			// Objects destroyed here, outside of lock.
+
+		}
+
+		// -----------------------------------------------------------
+
+	}; // mecs::EpochReclaimer
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_EPOCH_RECLAIMER_DECL
+#define MECS_EPOCH_RECLAIMER_DECL
+using mecs_EpochReclaimer = mecs::EpochReclaimer;
+#endif // !MECS_EPOCH_RECLAIMER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_EPOCH_RECLAIMER_HPP
@@ -0,0 +1,489 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef MECS_THREAD_POOL_HPP
+#include "ThreadPool.hpp"
+#endif // !MECS_THREAD_POOL_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// mecs::ThreadPool
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// FIELDS
+	// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	/** ThreadPool of the calling worker thread. **/
+	thread_local ThreadPool * ThreadPool::mWorkerPool( nullptr );
+
+	/** Index of the calling worker thread. **/
+	thread_local std::size_t ThreadPool::mWorkerIndex( 0 );
+#endif // MULTI-THREADING
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	 * ThreadPool constructor. Starts worker threads.
+	 *
+	 * @param pThreads - number of worker threads (ignored without multi-threading).
+	 * @param pThreadInit - job, executed by each worker thread at start (e.g. bind World), or null.
+	 * @throws - no exceptions.
+	**/
+	ThreadPool::ThreadPool( const std::size_t pThreads, job_t pThreadInit ) noexcept
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		: mMutex( ),
+		mCondition( ),
+		mStop( false ),
+		mPending( 0 ),
+		mSleeping( 0 ),
+		mThreadInit( std::move( pThreadInit ) ),
+		mWorkers( ),
+		mQueues( )
+	{
+
+		// Create jobs queues: one per worker & shared.
+		for ( std::size_t i = 0; i <= pThreads; i++ )
+			mQueues.push_back( std::make_shared<JobsQueue>( ) );
+
+		// Start worker threads.
+		mWorkers.reserve( pThreads );
+		for ( std::size_t i = 0; i < pThreads; i++ )
+			mWorkers.emplace_back( &ThreadPool::run, this, i );
+
+	}
+#else // ONE-THREAD
+		: mQueues( )
+	{
+
+		// Unused.
+		( void )pThreads;
+		( void )pThreadInit;
+
+		// Create shared jobs queue.
+		mQueues.push_back( std::make_shared<JobsQueue>( ) );
+
+	}
+#endif // MULTI-THREADING
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	 * ThreadPool destructor. Stops & joins worker threads, pending jobs are dropped.
+	 *
+	 * @throws - no exceptions.
+	**/
+	ThreadPool::~ThreadPool( ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Lock
+		mecs_ulock lock_( mMutex );
+
+		// Stop
+		mStop = true;
+
+		// Unlock
+		lock_.unlock( );
+
+		// Wake up worker threads.
+		mCondition.notify_all( );
+
+		// Join worker threads.
+		for ( std::thread & worker_lr : mWorkers )
+			worker_lr.join( );
+#endif // MULTI-THREADING
+
+	}
+
+	// ===========================================================
+	// GETTERS & SETTERS
+	// ===========================================================
+
+	/**
+	 * Returns number of worker threads.
+	 *
+	 * @thread_safety - not required.
+	 * @throws - no exceptions.
+	**/
+	std::size_t ThreadPool::getThreadsCount( ) const noexcept
+	{
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		return( mWorkers.size( ) );
+#else // ONE-THREAD
+		return( 0 );
+#endif // MULTI-THREADING
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Take job: own jobs, then shared jobs, then steal half of other worker jobs.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pJob - taken job.
+	 * @return - 'true' if job taken.
+	 * @throws - no exceptions.
+	**/
+	bool ThreadPool::take( job_t & pJob ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Calling thread is worker of this ThreadPool.
+		const bool worker_( mWorkerPool == this );
+
+		// Number of workers, shared queue index.
+		const std::size_t workers_( mQueues.size( ) - 1 );
+
+		// Own jobs (LIFO).
+		if ( worker_ )
+		{
+
+			// Own queue
+			JobsQueue & queue_( *mQueues[mWorkerIndex] );
+
+			// Lock
+			mecs_ulock lock_( queue_.mMutex );
+
+			// Take last job
+			if ( !queue_.mJobs.empty( ) )
+			{
+				pJob = std::move( queue_.mJobs.back( ) );
+				queue_.mJobs.pop_back( );
+				mPending.fetch_sub( 1 );
+				return( true );
+			}
+
+		}
+
+		// Shared jobs (FIFO).
+		{
+
+			// Shared queue
+			JobsQueue & queue_( *mQueues[workers_] );
+
+			// Lock
+			mecs_ulock lock_( queue_.mMutex );
+
+			// Take first job
+			if ( !queue_.mJobs.empty( ) )
+			{
+				pJob = std::move( queue_.mJobs.front( ) );
+				queue_.mJobs.pop_front( );
+				mPending.fetch_sub( 1 );
+				return( true );
+			}
+
+		}
+
+		// Steal half of other worker jobs.
+		const std::size_t start_( worker_ ? mWorkerIndex + 1 : 0 );
+		for ( std::size_t i = 0; i < workers_; i++ )
+		{
+
+			// Victim index
+			const std::size_t victim_( ( start_ + i ) % workers_ );
+
+			// Skip own queue
+			if ( worker_ && victim_ == mWorkerIndex )
+				continue;
+
+			// Victim queue
+			JobsQueue & queue_( *mQueues[victim_] );
+
+			// Lock
+			mecs_ulock lock_( queue_.mMutex );
+
+			// Skip empty queue
+			if ( queue_.mJobs.empty( ) )
+				continue;
+
+			// Number of jobs to steal.
+			const std::size_t count_( worker_ ? ( queue_.mJobs.size( ) + 1 ) / 2 : 1 );
+
+			// Take first job
+			pJob = std::move( queue_.mJobs.front( ) );
+			queue_.mJobs.pop_front( );
+
+			// Take the rest of stolen jobs.
+			mecs_vector<job_t> stolen_;
+			stolen_.reserve( count_ - 1 );
+			for ( std::size_t j = 1; j < count_; j++ )
+			{
+				stolen_.push_back( std::move( queue_.mJobs.front( ) ) );
+				queue_.mJobs.pop_front( );
+			}
+
+			// Unlock
+			lock_.unlock( );
+
+			// Move stolen jobs to own queue.
+			if ( !stolen_.empty( ) )
+			{
+
+				// Own queue
+				JobsQueue & own_( *mQueues[mWorkerIndex] );
+
+				// Lock
+				mecs_ulock ownLock_( own_.mMutex );
+
+				// Add jobs
+				for ( job_t & job_lr : stolen_ )
+					own_.mJobs.push_back( std::move( job_lr ) );
+
+			}
+
+			mPending.fetch_sub( 1 );
+			return( true );
+
+		}
+
+		return( false );
+#else // ONE-THREAD
+		// Shared queue
+		JobsQueue & queue_( *mQueues.back( ) );
+
+		// Cancel
+		if ( queue_.mJobs.empty( ) )
+			return( false );
+
+		// Take first job
+		pJob = std::move( queue_.mJobs.front( ) );
+		queue_.mJobs.pop_front( );
+		return( true );
+#endif // MULTI-THREADING
+
+	}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	/**
+	 * Worker thread loop.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pIndex - worker index.
+	 * @throws - no exceptions.
+	**/
+	void ThreadPool::run( const std::size_t pIndex ) noexcept
+	{
+
+		// Bind worker thread to this ThreadPool.
+		mWorkerPool = this;
+		mWorkerIndex = pIndex;
+
+		// Initialize worker thread.
+		if ( mThreadInit )
+			mThreadInit( );
+
+		// Job
+		job_t job_;
+
+		while ( !mStop )
+		{
+
+			// Execute job
+			if ( take( job_ ) )
+			{
+				job_( );
+				job_ = nullptr;
+				continue;
+			}
+
+			// Lock
+			mecs_ulock lock_( mMutex );
+
+			// Sleep, until jobs submitted or stopped.
+			mSleeping.fetch_add( 1 );
+			mCondition.wait( lock_, [this]( ) { return( mStop || mPending.load( ) > 0 ); } );
+			mSleeping.fetch_sub( 1 );
+
+		}
+
+	}
+#endif // MULTI-THREADING
+
+	/**
+	 * Submit job. Job, submitted by worker thread, goes to its own deque.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pJob - job.
+	 * @throws - no exceptions.
+	**/
+	void ThreadPool::submit( job_t pJob ) noexcept
+	{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Own queue of worker thread, or shared queue.
+		JobsQueue & queue_( *mQueues[mWorkerPool == this ? mWorkerIndex : mQueues.size( ) - 1] );
+
+		// Count job before it is visible, so it can't be taken uncounted.
+		mPending.fetch_add( 1 );
+
+		// Lock
+		mecs_ulock lock_( queue_.mMutex );
+
+		// Add job
+		queue_.mJobs.push_back( std::move( pJob ) );
+
+		// Unlock
+		lock_.unlock( );
+
+		// Wake up sleeping worker thread.
+		if ( mSleeping.load( ) > 0 )
+		{
+			mecs_ulock sleepLock_( mMutex );
+			sleepLock_.unlock( );
+			mCondition.notify_one( );
+		}
+#else // ONE-THREAD
+		// Add job
+		mQueues.back( )->mJobs.push_back( std::move( pJob ) );
+#endif // MULTI-THREADING
+
+	}
+
+	/**
+	 * Execute one pending job on the calling thread.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @return - 'true' if job executed, 'false' if there are no pending jobs.
+	 * @throws - no exceptions.
+	**/
+	bool ThreadPool::runPending( ) noexcept
+	{
+
+		// Job
+		job_t job_;
+
+		// Cancel
+		if ( !take( job_ ) )
+			return( false );
+
+		// Execute job
+		job_( );
+
+		return( true );
+
+	}
+
+	/**
+	 * Split [begin, end) range into chunks of grain size, & process them in
+	 * parallel. Returns when all chunks are processed, calling thread helps.
+	 *
+	 * @thread_safety - thread-lock used.
+	 * @param pBegin - range begin.
+	 * @param pEnd - range end.
+	 * @param pGrain - number of elements in chunk.
+	 * @param pJob - range job.
+	 * @throws - no exceptions.
+	**/
+	void ThreadPool::parallelFor( const std::size_t pBegin, const std::size_t pEnd, const std::size_t pGrain, const range_job_t & pJob ) noexcept
+	{
+
+		// Cancel
+		if ( pEnd <= pBegin )
+			return;
+
+		// Chunk size.
+		const std::size_t grain_( pGrain > 0 ? pGrain : 1 );
+
+		// Process whole range on the calling thread.
+		if ( pEnd - pBegin <= grain_ || getThreadsCount( ) == 0 )
+		{
+			pJob( pBegin, pEnd );
+			return;
+		}
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		// Number of chunks.
+		const std::size_t chunks_( ( pEnd - pBegin + grain_ - 1 ) / grain_ );
+
+		// Number of chunks, not processed yet by other threads.
+		mecs_atomic<std::size_t> remaining_( chunks_ - 1 );
+
+		// Submit chunks, except the first one.
+		for ( std::size_t chunk_ = 1; chunk_ < chunks_; chunk_++ )
+		{
+
+			// Chunk range.
+			const std::size_t begin_( pBegin + chunk_ * grain_ );
+			const std::size_t end_( std::min( begin_ + grain_, pEnd ) );
+
+			// Submit chunk
+			submit( [&pJob, &remaining_, begin_, end_]( )
+				{
+					pJob( begin_, end_ );
+					remaining_.fetch_sub( 1, std::memory_order_release );
+				} );
+
+		}
+
+		// Process the first chunk.
+		pJob( pBegin, pBegin + grain_ );
+
+		// Help other threads, until all chunks processed.
+		while ( remaining_.load( std::memory_order_acquire ) > 0 )
+		{
+			if ( !runPending( ) )
+				std::this_thread::yield( );
+		}
+#endif // MULTI-THREADING
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,313 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_THREAD_POOL_HPP
+#define MECS_THREAD_POOL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::ThreadPool
+	// ===========================================================
+
+	/**
+	 * ThreadPool - work-stealing worker threads, executing submitted jobs.
+	 * 
+	 * (?) Each worker has own jobs deque: worker pushes & pops own jobs at back
+	 * (LIFO, cache-hot), & steals half of other worker jobs from front, when own
+	 * deque is empty. Jobs, submitted by other threads, go to the shared deque.
+	 * 
+	 * (?) Threads, waiting for jobs (e.g. main thread at phase barrier), should help
+	 * with runPending instead of blocking.
+	 * 
+	 * (?) Without multi-threading, jobs are executed only by runPending.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class ThreadPool final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for job. **/
+		using job_t = std::function<void( )>;
+
+		/** Type-alias for range job, called with [begin, end) range. **/
+		using range_job_t = std::function<void( const std::size_t, const std::size_t )>;
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Size of data chunk, processed by one parallelFor job (fits L1 cache). **/
+		static constexpr const std::size_t CHUNK_SIZE = 16 * 1024;
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// mecs::ThreadPool::JobsQueue
+		// ===========================================================
+
+		/**
+		 * JobsQueue - jobs deque of worker thread (or shared), on own cache-line.
+		**/
+		struct alignas( 64 ) JobsQueue final
+		{
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+			/** Mutex. **/
+			mecs_mutex mMutex;
+#endif // MULTI-THREADING
+
+			/** Jobs. **/
+			mecs_deque<job_t> mJobs;
+
+		}; // mecs::ThreadPool::JobsQueue
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/** ThreadPool of the calling worker thread. **/
+		static thread_local ThreadPool * mWorkerPool;
+
+		/** Index of the calling worker thread. **/
+		static thread_local std::size_t mWorkerIndex;
+
+		/** Sleep mutex. **/
+		mecs_mutex mMutex;
+
+		/** Jobs condition. **/
+		mecs_condition mCondition;
+
+		/** Stop flag. **/
+		mecs_abool mStop;
+
+		/** Number of queued jobs. **/
+		mecs_atomic<std::size_t> mPending;
+
+		/** Number of sleeping worker threads. **/
+		mecs_atomic<std::size_t> mSleeping;
+
+		/** Worker thread initialization job. **/
+		job_t mThreadInit;
+
+		/** Worker threads. **/
+		mecs_vector<std::thread> mWorkers;
+#endif // MULTI-THREADING
+
+		/** Jobs queues: one per worker thread, & shared queue last. **/
+		mecs_vector<mecs_shared<JobsQueue>> mQueues;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Take job: own jobs, then shared jobs, then steal half of other worker jobs.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pJob - taken job.
+		 * @return - 'true' if job taken.
+		 * @throws - no exceptions.
+		**/
+		bool take( job_t & pJob ) noexcept;
+
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		/**
+		 * Worker thread loop.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pIndex - worker index.
+		 * @throws - no exceptions.
+		**/
+		void run( const std::size_t pIndex ) noexcept;
+#endif // MULTI-THREADING
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted ThreadPool const copy constructor */
+		ThreadPool( const ThreadPool & ) = delete;
+
+		/* @deleted ThreadPool const copy assignment operator */
+		ThreadPool & operator=( const ThreadPool & ) = delete;
+
+		/* @deleted ThreadPool move constructor */
+		ThreadPool( ThreadPool && ) = delete;
+
+		/* @deleted ThreadPool move assignment operator */
+		ThreadPool & operator=( ThreadPool && ) = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * ThreadPool constructor. Starts worker threads.
+		 *
+		 * @param pThreads - number of worker threads (ignored without multi-threading).
+		 * @param pThreadInit - job, executed by each worker thread at start (e.g. bind World), or null.
+		 * @throws - no exceptions.
+		**/
+		explicit ThreadPool( const std::size_t pThreads, job_t pThreadInit = nullptr ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * ThreadPool destructor. Stops & joins worker threads, pending jobs are dropped.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~ThreadPool( ) noexcept;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns number of worker threads.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		std::size_t getThreadsCount( ) const noexcept;
+
+		/**
+		 * Returns number of elements of the type, processed by one parallelFor job.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		template <typename T>
+		static constexpr std::size_t getGrain( ) noexcept
+		{ return( sizeof( T ) < CHUNK_SIZE ? CHUNK_SIZE / sizeof( T ) : 1 ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Submit job. Job, submitted by worker thread, goes to its own deque.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pJob - job.
+		 * @throws - no exceptions.
+		**/
+		void submit( job_t pJob ) noexcept;
+
+		/**
+		 * Execute one pending job on the calling thread.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @return - 'true' if job executed, 'false' if there are no pending jobs.
+		 * @throws - no exceptions.
+		**/
+		bool runPending( ) noexcept;
+
+		/**
+		 * Split [begin, end) range into chunks of grain size, & process them in
+		 * parallel. Returns when all chunks are processed, calling thread helps.
+		 * 
+		 * (?) Use getGrain for cache-sized chunks of Components.
+		 *
+		 * @thread_safety - thread-lock used.
+		 * @param pBegin - range begin.
+		 * @param pEnd - range end.
+		 * @param pGrain - number of elements in chunk.
+		 * @param pJob - range job.
+		 * @throws - no exceptions.
+		**/
+		void parallelFor( const std::size_t pBegin, const std::size_t pEnd, const std::size_t pGrain, const range_job_t & pJob ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::ThreadPool
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_THREAD_POOL_DECL
+#define MECS_THREAD_POOL_DECL
+using mecs_ThreadPool = mecs::ThreadPool;
+#endif // !MECS_THREAD_POOL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_THREAD_POOL_HPP
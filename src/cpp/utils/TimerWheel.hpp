@@ -0,0 +1,523 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_TIMER_WHEEL_HPP
+#define MECS_TIMER_WHEEL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::TimerWheel
+	// ===========================================================
+
+	/**
+	 * TimerWheel - hierarchical timing wheel: values are scheduled for a tick,
+	 * once or periodically, & passed to a callback when the tick is reached.
+	 * 
+	 * (?) 4 levels of 64 slots: level N slot covers 64^N ticks. Timer is placed
+	 * to the lowest level, where due tick & current tick differ only in the
+	 * level bits, & moves down (cascades) when its slot is reached. Later due
+	 * ticks wait in overflow list. Insert & cancel are O(1), update is
+	 * amortized O(1) per tick (timer cascades at most once per level).
+	 * 
+	 * (?) Timers are stored in a vector, linked by indices, & reused through
+	 * free-list, so steady-state scheduling doesn't allocate.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	template <typename T>
+	class TimerWheel final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for timer ID: generation (high 32 bits) & index. **/
+		using timer_id_t = std::uint64_t;
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Invalid timer ID. **/
+		static constexpr const timer_id_t INVALID_TIMER = 0;
+
+		/** Number of bits of slot index. **/
+		static constexpr const std::uint32_t SLOT_BITS = 6;
+
+		/** Number of slots per level. **/
+		static constexpr const std::uint32_t SLOTS_COUNT = 1 << SLOT_BITS;
+
+		/** Number of levels. **/
+		static constexpr const std::uint32_t LEVELS_COUNT = 4;
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** No timer (end of list). **/
+		static constexpr const std::uint32_t NO_TIMER = 0xFFFFFFFF;
+
+		/** List index of overflow list. **/
+		static constexpr const std::uint32_t OVERFLOW_LIST = LEVELS_COUNT * SLOTS_COUNT;
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// mecs::TimerWheel::Timer
+		// ===========================================================
+
+		/**
+		 * Timer - scheduled value.
+		**/
+		struct Timer final
+		{
+
+			/** Value. **/
+			T mValue;
+
+			/** Due tick. **/
+			std::uint64_t mDue;
+
+			/** Period, in ticks, 0 for one-shot timer. **/
+			std::uint32_t mPeriod;
+
+			/** Generation, changed when timer is freed. **/
+			std::uint32_t mGeneration;
+
+			/** Previous timer in list. **/
+			std::uint32_t mPrev;
+
+			/** Next timer in list (or in free-list). **/
+			std::uint32_t mNext;
+
+			/** List index, NO_TIMER if not scheduled. **/
+			std::uint32_t mList;
+
+		}; // mecs::TimerWheel::Timer
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Current tick. **/
+		std::uint64_t mTick;
+
+		/** Timers. **/
+		mecs_vector<Timer> mTimers;
+
+		/** First free timer. **/
+		std::uint32_t mFree;
+
+		/** Number of scheduled timers. **/
+		std::uint32_t mCount;
+
+		/** Lists heads: slots of levels, & overflow list. **/
+		std::uint32_t mLists[OVERFLOW_LIST + 1];
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Link timer to list by due tick.
+		 *
+		 * @param pIndex - timer index.
+		 * @throws - no exceptions.
+		**/
+		void link( const std::uint32_t pIndex ) noexcept
+		{
+
+			// Timer
+			Timer & timer_lr = mTimers[pIndex];
+
+			// List: lowest level, where due & current ticks differ only in level bits.
+			const std::uint64_t diff_( timer_lr.mDue ^ mTick );
+			std::uint32_t list_( OVERFLOW_LIST );
+			for ( std::uint32_t level_ = 0; level_ < LEVELS_COUNT; level_++ )
+			{
+				if ( ( diff_ >> ( SLOT_BITS * ( level_ + 1 ) ) ) == 0 )
+				{
+					list_ = level_ * SLOTS_COUNT + static_cast<std::uint32_t>( ( timer_lr.mDue >> ( SLOT_BITS * level_ ) ) & ( SLOTS_COUNT - 1 ) );
+					break;
+				}
+			}
+
+			// Push front
+			timer_lr.mList = list_;
+			timer_lr.mPrev = NO_TIMER;
+			timer_lr.mNext = mLists[list_];
+			if ( timer_lr.mNext != NO_TIMER )
+				mTimers[timer_lr.mNext].mPrev = pIndex;
+			mLists[list_] = pIndex;
+
+		}
+
+		/**
+		 * Unlink timer from its list.
+		 *
+		 * @param pIndex - timer index.
+		 * @throws - no exceptions.
+		**/
+		void unlink( const std::uint32_t pIndex ) noexcept
+		{
+
+			// Timer
+			Timer & timer_lr = mTimers[pIndex];
+
+			// Unlink
+			if ( timer_lr.mPrev != NO_TIMER )
+				mTimers[timer_lr.mPrev].mNext = timer_lr.mNext;
+			else
+				mLists[timer_lr.mList] = timer_lr.mNext;
+			if ( timer_lr.mNext != NO_TIMER )
+				mTimers[timer_lr.mNext].mPrev = timer_lr.mPrev;
+
+			timer_lr.mList = NO_TIMER;
+
+		}
+
+		/**
+		 * Free timer, releasing its value.
+		 *
+		 * @param pIndex - timer index.
+		 * @throws - no exceptions.
+		**/
+		void release( const std::uint32_t pIndex ) noexcept
+		{
+
+			// Timer
+			Timer & timer_lr = mTimers[pIndex];
+
+			// Release value, invalidate ID.
+			timer_lr.mValue = T( );
+			timer_lr.mGeneration++;
+			if ( timer_lr.mGeneration == 0 )
+				timer_lr.mGeneration = 1;
+
+			// Push to free-list.
+			timer_lr.mList = NO_TIMER;
+			timer_lr.mNext = mFree;
+			mFree = pIndex;
+
+			mCount--;
+
+		}
+
+		/**
+		 * Re-link all timers of the list, by current tick.
+		 *
+		 * @param pList - list index.
+		 * @throws - no exceptions.
+		**/
+		void cascade( const std::uint32_t pList ) noexcept
+		{
+
+			// Detach list
+			std::uint32_t index_( mLists[pList] );
+			mLists[pList] = NO_TIMER;
+
+			// Re-link timers
+			while ( index_ != NO_TIMER )
+			{
+				const std::uint32_t next_( mTimers[index_].mNext );
+				link( index_ );
+				index_ = next_;
+			}
+
+		}
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * TimerWheel constructor.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit TimerWheel( ) noexcept
+			: mTick( 0 ),
+			mTimers( ),
+			mFree( NO_TIMER ),
+			mCount( 0 )
+		{
+
+			// Reset lists
+			for ( std::uint32_t list_ = 0; list_ <= OVERFLOW_LIST; list_++ )
+				mLists[list_] = NO_TIMER;
+
+		}
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns current tick.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		std::uint64_t getTick( ) const noexcept
+		{ return( mTick ); }
+
+		/**
+		 * Returns number of scheduled timers.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		std::uint32_t getCount( ) const noexcept
+		{ return( mCount ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Schedule value.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pValue - value.
+		 * @param pDue - due tick, passed ticks are handled on the next update.
+		 * @param pPeriod - period, in ticks, 0 for one-shot timer.
+		 * @return - timer ID, to cancel it.
+		 * @throws - no exceptions.
+		**/
+		timer_id_t add( const T & pValue, const std::uint64_t pDue, const std::uint32_t pPeriod ) noexcept
+		{
+
+			// Take free timer, or add new one.
+			std::uint32_t index_( mFree );
+			if ( index_ != NO_TIMER )
+				mFree = mTimers[index_].mNext;
+			else
+			{
+				index_ = static_cast<std::uint32_t>( mTimers.size( ) );
+				mTimers.push_back( Timer{ T( ), 0, 0, 1, NO_TIMER, NO_TIMER, NO_TIMER } );
+			}
+
+			// Timer
+			Timer & timer_lr = mTimers[index_];
+			timer_lr.mValue = pValue;
+			timer_lr.mDue = pDue > mTick ? pDue : mTick + 1;
+			timer_lr.mPeriod = pPeriod;
+
+			// Schedule
+			link( index_ );
+			mCount++;
+
+			// Return ID
+			return( ( static_cast<timer_id_t>( timer_lr.mGeneration ) << 32 ) | index_ );
+
+		}
+
+		/**
+		 * Cancel timer.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pTimerID - timer ID.
+		 * @return - 'true' if timer was scheduled.
+		 * @throws - no exceptions.
+		**/
+		bool cancel( const timer_id_t pTimerID ) noexcept
+		{
+
+			// Timer index
+			const std::uint32_t index_( static_cast<std::uint32_t>( pTimerID ) );
+
+			// Cancel, if timer is not scheduled, or ID is outdated.
+			if ( index_ >= mTimers.size( ) || mTimers[index_].mList == NO_TIMER
+				|| mTimers[index_].mGeneration != static_cast<std::uint32_t>( pTimerID >> 32 ) )
+				return( false );
+
+			// Remove timer
+			unlink( index_ );
+			release( index_ );
+
+			return( true );
+
+		}
+
+		/**
+		 * Advance ticks, & pass values of due timers to callback.
+		 * Periodic timers are scheduled again, with the same value.
+		 *
+		 * @thread_safety - not thread-safe, callback must not use TimerWheel.
+		 * @param pTicks - number of ticks.
+		 * @param pCallback - callback, called with value reference.
+		 * @throws - no exceptions.
+		**/
+		template <typename F>
+		void update( const std::uint32_t pTicks, F && pCallback ) noexcept
+		{
+
+			for ( std::uint32_t step_ = 0; step_ < pTicks; step_++ )
+			{
+
+				// Next tick
+				mTick++;
+
+				// Re-link overflow timers, when the top level wraps.
+				if ( ( mTick & ( ( static_cast<std::uint64_t>( 1 ) << ( SLOT_BITS * LEVELS_COUNT ) ) - 1 ) ) == 0 )
+					cascade( OVERFLOW_LIST );
+
+				// Cascade higher levels first, when their slot is reached.
+				for ( std::uint32_t level_ = LEVELS_COUNT - 1; level_ > 0; level_-- )
+				{
+					if ( ( mTick & ( ( static_cast<std::uint64_t>( 1 ) << ( SLOT_BITS * level_ ) ) - 1 ) ) == 0 )
+						cascade( level_ * SLOTS_COUNT + static_cast<std::uint32_t>( ( mTick >> ( SLOT_BITS * level_ ) ) & ( SLOTS_COUNT - 1 ) ) );
+				}
+
+				// Detach due timers.
+				const std::uint32_t list_( static_cast<std::uint32_t>( mTick & ( SLOTS_COUNT - 1 ) ) );
+				std::uint32_t index_( mLists[list_] );
+				mLists[list_] = NO_TIMER;
+
+				// Handle due timers.
+				while ( index_ != NO_TIMER )
+				{
+
+					// Timer
+					Timer & timer_lr = mTimers[index_];
+					const std::uint32_t next_( timer_lr.mNext );
+
+					// Pass value
+					pCallback( timer_lr.mValue );
+
+					// Schedule periodic timer again, or free it.
+					if ( timer_lr.mPeriod > 0 )
+					{
+						timer_lr.mDue = mTick + timer_lr.mPeriod;
+						link( index_ );
+					}
+					else
+						release( index_ );
+
+					index_ = next_;
+
+				}
+
+			}
+
+		}
+
+		/**
+		 * Cancel all timers.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		void clear( ) noexcept
+		{
+			for ( std::uint32_t index_ = 0; index_ < mTimers.size( ); index_++ )
+				cancel( ( static_cast<timer_id_t>( mTimers[index_].mGeneration ) << 32 ) | index_ );
+		}
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		TimerWheel( const TimerWheel & ) = delete;
+		TimerWheel & operator=( const TimerWheel & ) = delete;
+		TimerWheel( TimerWheel && ) = delete;
+		TimerWheel & operator=( TimerWheel && ) = delete;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::TimerWheel
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_TIMER_WHEEL_DECL
+#define MECS_TIMER_WHEEL_DECL
+template <typename T>
+using mecs_TimerWheel = mecs::TimerWheel<T>;
+#endif // !MECS_TIMER_WHEEL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_TIMER_WHEEL_HPP
@@ -0,0 +1,204 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef MECS_WORLD_HPP
+#include "World.hpp"
+#endif // !MECS_WORLD_HPP
+
+// Include mecs::ComponentsManager
+#ifndef MECS_COMPONENTS_MANAGER_HPP
+#include "../components/ComponentsManager.hpp"
+#endif // !MECS_COMPONENTS_MANAGER_HPP
+
+// Include mecs::EntitiesManager
+#ifndef MECS_ENTITIES_MANAGER_HPP
+#include "../entities/EntitiesManager.hpp"
+#endif // !MECS_ENTITIES_MANAGER_HPP
+
+// Include mecs::SystemsManager
+#ifndef MECS_SYSTEMS_MANAGER_HPP
+#include "../systems/SystemsManager.hpp"
+#endif // !MECS_SYSTEMS_MANAGER_HPP
+
+// Include mecs::EventsManager
+#ifndef MECS_EVENTS_MANAGER_HPP
+#include "../events/EventsManager.hpp"
+#endif // !MECS_EVENTS_MANAGER_HPP
+
+// Include mecs::CommandsManager
+#ifndef MECS_COMMANDS_MANAGER_HPP
+#include "../commands/CommandsManager.hpp"
+#endif // !MECS_COMMANDS_MANAGER_HPP
+
+// ===========================================================
+// mecs::World
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// FIELDS
+	// ===========================================================
+
+	/** Default World. **/
+	World * World::mDefault( nullptr );
+
+	/** World, bound to the calling thread. **/
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+	thread_local World * World::mCurrent( nullptr );
+#else // ONE-THREAD
+	World * World::mCurrent( nullptr );
+#endif // MULTI-THREADING
+
+	/** Components IDs of objects, created without World. **/
+	World::ids_map_t World::mDetachedComponentsIDs;
+
+	/** Entities IDs of objects, created without World. **/
+	World::ids_map_t World::mDetachedEntitiesIDs;
+
+	/** Events IDs of objects, created without World. **/
+	World::ids_map_t World::mDetachedEventsIDs;
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	 * World constructor. Creates all Managers.
+	 *
+	 * @throws - no exceptions.
+	**/
+	World::World( ) noexcept
+		: mComponentsIDs( ),
+		mEntitiesIDs( ),
+		mEventsIDs( ),
+		mReclaimer( ),
+		mComponentsManager( new ComponentsManager( ) ),
+		mEntitiesManager( new EntitiesManager( ) ),
+		mSystemsManager( new SystemsManager( ) ),
+		mEventsManager( new EventsManager( ) ),
+		mCommandsManager( new CommandsManager( ) )
+	{
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	 * World destructor. Deletes all Managers & retired objects.
+	 *
+	 * @throws - no exceptions.
+	**/
+	World::~World( ) noexcept
+	{
+
+		// Delete CommandsManager
+		delete mCommandsManager;
+		mCommandsManager = nullptr;
+
+		// Delete ComponentsManager
+		delete mComponentsManager;
+		mComponentsManager = nullptr;
+
+		// Delete EntitiesManager
+		delete mEntitiesManager;
+		mEntitiesManager = nullptr;
+
+		// Delete SystemsManager
+		delete mSystemsManager;
+		mSystemsManager = nullptr;
+
+		// Delete EventsManager
+		delete mEventsManager;
+		mEventsManager = nullptr;
+
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	 * Create default World.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void World::Initialize( ) noexcept
+	{
+
+		// Cancel
+		if ( mDefault != nullptr )
+			return;
+
+		// Create default World.
+		mDefault = new World( );
+
+	}
+
+	/**
+	 * Delete default World.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - no exceptions.
+	**/
+	void World::Terminate( ) noexcept
+	{
+
+		// Cancel
+		if ( mDefault == nullptr )
+			return;
+
+		// Delete default World.
+		delete mDefault;
+		mDefault = nullptr;
+
+	}
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,397 @@
+/**
+* Copyright © 2019 Denis Zyamaev (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Zyamaev (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+
+#ifndef MECS_WORLD_HPP
+#define MECS_WORLD_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs_types.hpp
+#ifndef MECS_TYPES_HPP
+#include "../cfg/ecs_types.hpp"
+#endif // !MECS_TYPES_HPP
+
+// Include mecs::IDMap
+#ifndef MECS_ID_MAP_HPP
+#include "../utils/IDMap.hpp"
+#endif // !MECS_ID_MAP_HPP
+
+// Include mecs::EpochReclaimer
+#ifndef MECS_EPOCH_RECLAIMER_HPP
+#include "../utils/EpochReclaimer.hpp"
+#endif // !MECS_EPOCH_RECLAIMER_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace mecs
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// mecs::World
+	// ===========================================================
+
+	/**
+	 * World - independent simulation: owns Managers (Components, Entities, Systems,
+	 * Events, Commands), IDs allocators & EpochReclaimer. Worlds share no locks, so
+	 * one process can run many Worlds (shards), one per thread (core).
+	 * 
+	 * (?) Static API of Managers, Components, Entities & Events uses World bound to
+	 * the calling thread (see setCurrent & Scope), or default World (see Initialize).
+	 * 
+	 * (!) Components, Entities & Events must be destroyed before their World.
+	 *
+	 * @authors Denis Z. (code4un@yandex.ru)
+	 * @version 1.0
+	 * @since 18.10.2026
+	**/
+	class World final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONFIGS
+		// ===========================================================
+
+		/** Type-alias for IDs map. **/
+		using ids_map_t = IDMap<const TypeID, ObjectID>;
+
+		// ===========================================================
+		// mecs::World::Scope
+		// ===========================================================
+
+		/**
+		 * Scope - RAII binding of World to the calling thread.
+		**/
+		class Scope final
+		{
+
+		private:
+
+			/** Previous World. **/
+			World * const mPrevious;
+
+			/* @deleted Scope const copy constructor */
+			Scope( const Scope & ) = delete;
+
+			/* @deleted Scope const copy assignment operator */
+			Scope & operator=( const Scope & ) = delete;
+
+		public:
+
+			/**
+			 * Scope constructor. Binds World to the calling thread.
+			 *
+			 * @param pWorld - World.
+			 * @throws - no exceptions.
+			**/
+			explicit Scope( World * const pWorld ) noexcept
+				: mPrevious( mCurrent )
+			{ mCurrent = pWorld; }
+
+			/**
+			 * Scope destructor. Restores previous World binding.
+			 *
+			 * @throws - no exceptions.
+			**/
+			~Scope( ) noexcept
+			{ mCurrent = mPrevious; }
+
+		}; // mecs::World::Scope
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FRIENDS
+		// ===========================================================
+
+		friend class ComponentsManager;
+		friend class EntitiesManager;
+		friend class SystemsManager;
+		friend class EventsManager;
+		friend class CommandsManager;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Default World. **/
+		static World * mDefault;
+
+		/** World, bound to the calling thread. **/
+#ifdef MECS_LIB_MT_ENABLED // MULTI-THREADING
+		static thread_local World * mCurrent;
+#else // ONE-THREAD
+		static World * mCurrent;
+#endif // MULTI-THREADING
+
+		/** Components IDs of objects, created without World. **/
+		static ids_map_t mDetachedComponentsIDs;
+
+		/** Entities IDs of objects, created without World. **/
+		static ids_map_t mDetachedEntitiesIDs;
+
+		/** Events IDs of objects, created without World. **/
+		static ids_map_t mDetachedEventsIDs;
+
+		/** Components IDs. **/
+		ids_map_t mComponentsIDs;
+
+		/** Entities IDs. **/
+		ids_map_t mEntitiesIDs;
+
+		/** Events IDs. **/
+		ids_map_t mEventsIDs;
+
+		/** EpochReclaimer. Destroyed before IDs maps, because retired objects return IDs. **/
+		EpochReclaimer mReclaimer;
+
+		/** ComponentsManager. **/
+		ComponentsManager * mComponentsManager;
+
+		/** EntitiesManager. **/
+		EntitiesManager * mEntitiesManager;
+
+		/** SystemsManager. **/
+		SystemsManager * mSystemsManager;
+
+		/** EventsManager. **/
+		EventsManager * mEventsManager;
+
+		/** CommandsManager. **/
+		CommandsManager * mCommandsManager;
+
+		// ===========================================================
+		// DELETED
+		// ===========================================================
+
+		/* @deleted World const copy constructor */
+		World( const World & ) = delete;
+
+		/* @deleted World const copy assignment operator */
+		World & operator=( const World & ) = delete;
+
+		/* @deleted World move constructor */
+		World( World && ) = delete;
+
+		/* @deleted World move assignment operator */
+		World & operator=( World && ) = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		 * World constructor. Creates all Managers.
+		 *
+		 * @throws - no exceptions.
+		**/
+		explicit World( ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		 * World destructor. Deletes all Managers & retired objects.
+		 *
+		 * @throws - no exceptions.
+		**/
+		~World( ) noexcept;
+
+		// ===========================================================
+		// GETTERS & SETTERS
+		// ===========================================================
+
+		/**
+		 * Returns World, bound to the calling thread, or default World.
+		 *
+		 * @thread_safety - thread-local used.
+		 * @return - World, or null.
+		 * @throws - no exceptions.
+		**/
+		static World * getCurrent( ) noexcept
+		{ return( mCurrent != nullptr ? mCurrent : mDefault ); }
+
+		/**
+		 * Bind World to the calling thread.
+		 *
+		 * @thread_safety - thread-local used.
+		 * @param pWorld - World, or null to use default World.
+		 * @throws - no exceptions.
+		**/
+		static void setCurrent( World * const pWorld ) noexcept
+		{ mCurrent = pWorld; }
+
+		/**
+		 * Returns default World, or null.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		static World * getDefault( ) noexcept
+		{ return( mDefault ); }
+
+		/**
+		 * Returns Components IDs.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		ids_map_t & getComponentsIDs( ) noexcept
+		{ return( mComponentsIDs ); }
+
+		/**
+		 * Returns Entities IDs.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		ids_map_t & getEntitiesIDs( ) noexcept
+		{ return( mEntitiesIDs ); }
+
+		/**
+		 * Returns Events IDs.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		ids_map_t & getEventsIDs( ) noexcept
+		{ return( mEventsIDs ); }
+
+		/**
+		 * Returns Components IDs of the current World, or shared IDs if there is no World.
+		 *
+		 * @thread_safety - thread-local used.
+		 * @throws - no exceptions.
+		**/
+		static ids_map_t & getCurrentComponentsIDs( ) noexcept
+		{
+			World * const world_( getCurrent( ) );
+			return( world_ != nullptr ? world_->mComponentsIDs : mDetachedComponentsIDs );
+		}
+
+		/**
+		 * Returns Entities IDs of the current World, or shared IDs if there is no World.
+		 *
+		 * @thread_safety - thread-local used.
+		 * @throws - no exceptions.
+		**/
+		static ids_map_t & getCurrentEntitiesIDs( ) noexcept
+		{
+			World * const world_( getCurrent( ) );
+			return( world_ != nullptr ? world_->mEntitiesIDs : mDetachedEntitiesIDs );
+		}
+
+		/**
+		 * Returns Events IDs of the current World, or shared IDs if there is no World.
+		 *
+		 * @thread_safety - thread-local used.
+		 * @throws - no exceptions.
+		**/
+		static ids_map_t & getCurrentEventsIDs( ) noexcept
+		{
+			World * const world_( getCurrent( ) );
+			return( world_ != nullptr ? world_->mEventsIDs : mDetachedEventsIDs );
+		}
+
+		/**
+		 * Returns EpochReclaimer.
+		 *
+		 * @thread_safety - not required.
+		 * @throws - no exceptions.
+		**/
+		EpochReclaimer & getReclaimer( ) noexcept
+		{ return( mReclaimer ); }
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		 * Create default World.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		static void Initialize( ) noexcept;
+
+		/**
+		 * Delete default World.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - no exceptions.
+		**/
+		static void Terminate( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // mecs::World
+
+	// -----------------------------------------------------------
+
+} // mecs
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+#ifndef MECS_WORLD_DECL
+#define MECS_WORLD_DECL
+using mecs_World = mecs::World;
+#endif // !MECS_WORLD_DECL
+
+// -----------------------------------------------------------
+
+#endif // !MECS_WORLD_HPP